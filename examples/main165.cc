@@ -0,0 +1,101 @@
+// main165.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: merging; Dire; performance
+
+// Benchmark of the shower state variables used by the merging history
+// construction. Clusterings of final-state partons are collected from
+// e+e- -> Z -> partons events showered by Dire, and then the state
+// variables of each are obtained as the merging code reads them (z, t
+// and radBefID), once from the map<string,double> returned by
+// getStateVariables and once from the fixed-layout StateVariables
+// returned by stateVariables. It is also checked that the values agree.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events, and number of times their clusterings are used.
+  int nEvent  = 50;
+  int nRepeat = 200;
+  typedef std::chrono::steady_clock Clock;
+
+  // Z -> partons with the Dire shower, no hadronization.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  for (const char* line : {"Beams:idA = 11", "Beams:idB = -11",
+    "Beams:eCM = 91.1876", "WeakSingleBoson:ffbar2gmZ = on",
+    "23:onMode = off", "23:onIfAny = 1 2 3 4 5", "PDF:lepton = off",
+    "PartonShowers:model = 3", "HadronLevel:all = off", "Print:quiet = on"})
+    pythia.readString(line);
+  if (!pythia.init()) return 1;
+  TimeShowerPtr timesPtr = pythia.getShowerModelPtr()->getTimeShower();
+
+  // Collect clusterings: a final gluon, a colour-connected radiator and
+  // some other final parton as recoiler.
+  vector<Event> events;
+  vector< vector<int> > clusterings;
+  vector<string> names;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+    events.push_back(pythia.event);
+    const Event& event = events.back();
+    for (int iEmt = 0; iEmt < event.size(); ++iEmt) {
+      if (!event[iEmt].isFinal() || event[iEmt].id() != 21) continue;
+      int iRad = 0;
+      int iRec = 0;
+      for (int i = 0; i < event.size(); ++i) {
+        if (i == iEmt || !event[i].isFinal() || !event[i].isParton())
+          continue;
+        if (iRad == 0 && ( (event[i].col() > 0
+          && event[i].col() == event[iEmt].acol()) || (event[i].acol() > 0
+          && event[i].acol() == event[iEmt].col()) )) iRad = i;
+        else if (iRec == 0) iRec = i;
+      }
+      if (iRad == 0 || iRec == 0) continue;
+      clusterings.push_back( {int(events.size()) - 1, iRad, iEmt, iRec});
+      names.push_back( (event[iRad].id() == 21) ? "Dire_fsr_qcd_21->21&21a"
+        : "Dire_fsr_qcd_1->1&21");
+    }
+  }
+
+  // Time the map and the fixed-layout versions.
+  cout << "\n Dire state variables for " << clusterings.size()
+       << " clusterings of Z -> partons:";
+  vector<double> sums(2, 0.);
+  for (int iVersion = 0; iVersion < 2; ++iVersion) {
+    Clock::time_point t0 = Clock::now();
+    for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat)
+    for (int iClus = 0; iClus < int(clusterings.size()); ++iClus) {
+      const vector<int>& clus = clusterings[iClus];
+      const Event& event = events[clus[0]];
+      if (iVersion == 0) {
+        map<string,double> vars = timesPtr->getStateVariables( event,
+          clus[1], clus[2], clus[3], names[iClus]);
+        sums[0] += vars["z"] + vars["t"] + vars["radBefID"];
+      } else {
+        StateVariables vars = timesPtr->stateVariables( event, clus[1],
+          clus[2], clus[3], names[iClus]);
+        sums[1] += vars[StateVariables::Z] + vars[StateVariables::T]
+          + vars[StateVariables::RADBEFID];
+      }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    cout << fixed << "\n   " << ((iVersion == 0) ? "map<string,double>"
+         : "StateVariables    ") << ": " << setprecision(1) << setw(7)
+         << 1e9 * seconds / (nRepeat * clusterings.size())
+         << " ns per call, sum " << setprecision(6) << sums[iVersion]
+         / nRepeat;
+  }
+  cout << "\n Values " << ((sums[0] == sums[1]) ? "agree" : "DIFFER")
+       << endl;
+
+  // Done.
+  return (sums[0] == sums[1]) ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+// main205.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: parton distribution; LHAPDF; performance
+
+// Benchmark of the LHAGrid1 interpolation, in PDF calls per second, for
+// some of the grids shipped with Pythia. Each call is at a new random
+// (x, Q2) point, so that all flavours are interpolated anew, and is done
+// both one point at a time and through the batched xfBatch interface.
+// The accuracy is checked by the momentum sum rule, by comparing xfBatch
+// with single calls and, optionally, by comparing with the LHAPDF6 plugin.
+// Usage: ./main205 [LHAPDF6 set name, e.g. NNPDF31_lo_as_0118].
+
+#include "Pythia8/Pythia.h"
+#include "Pythia8/Plugins.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main(int argc, char* argv[]) {
+
+  // Number of points, and the flavours summed in the sum rule.
+  int nPoint = 2000000;
+  vector<int> idSum = {-5, -4, -3, -2, -1, 1, 2, 3, 4, 5, 21};
+  typedef std::chrono::steady_clock Clock;
+
+  // Grid files to study, and optional LHAPDF6 set to compare with.
+  vector<string> setNames = {"NNPDF31_lo_as_0118_0000.dat",
+    "NNPDF23_lo_as_0130_qed_0000.dat", "SU21proton.dat"};
+  string lhapdfSet = (argc > 1) ? argv[1] : "";
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  string pdfPath = pythia.settings.word("xmlPath") + "../pdfdata";
+  Logger logger;
+
+  // Random points, flat in log(x) and log(Q2).
+  Rndm rndm(Rndm::DEFAULTSEED);
+  vector<double> xPoint(nPoint), Q2Point(nPoint), xfOut;
+  for (int i = 0; i < nPoint; ++i) {
+    xPoint[i]  = pow(1e-7, rndm.flat());
+    Q2Point[i] = 3. * pow(1e7, rndm.flat());
+  }
+
+  // Loop over grids.
+  for (const string& setName : setNames) {
+    LHAGrid1 pdf( 2212, setName, pdfPath, &logger);
+    cout << "\n PDF grid " << setName << ":";
+
+    // Time single calls and the batched interface.
+    Clock::time_point t0 = Clock::now();
+    double sumSingle = 0.;
+    for (int i = 0; i < nPoint; ++i)
+      sumSingle += pdf.xf( 21, xPoint[i], Q2Point[i]);
+    double secSingle = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    t0 = Clock::now();
+    pdf.xfBatch( 21, xPoint, Q2Point, xfOut);
+    double secBatch = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    double sumBatch = 0.;
+    for (double xf : xfOut) sumBatch += xf;
+    cout << fixed << setprecision(2) << "\n   single calls: " << setw(6)
+         << 1e-6 * nPoint / secSingle << " M calls per second"
+         << "\n   xfBatch:      " << setw(6) << 1e-6 * nPoint / secBatch
+         << " M calls per second, " << ((sumBatch == sumSingle)
+         ? "identical to" : "DIFFERENT from") << " single calls";
+
+    // Momentum sum rule at a few scales, integrated in log(x), i.e.
+    // sum over flavours of the integral of x f(x) dx = x^2 f(x) dlog(x).
+    int nx = 2000;
+    double xMinSum = 1e-7;
+    for (double Q2 : {10., 1e4}) {
+      double sum = 0.;
+      for (int ix = 0; ix < nx; ++ix) {
+        double x = pow(xMinSum, 1. - (ix + 0.5) / nx);
+        for (int id : idSum) sum += x * pdf.xf( id, x, Q2);
+      }
+      sum *= -log(xMinSum) / nx;
+      cout << "\n   momentum sum rule at Q2 = " << setw(7) << setprecision(0)
+           << Q2 << ": " << setprecision(4) << sum;
+    }
+
+    // Optional comparison with the LHAPDF6 plugin.
+    if (lhapdfSet != "" && setName.find(lhapdfSet) == 0) {
+      PDFPtr pdfLHA = make_plugin<PDF>("libpythia8lhapdf6.so", "LHAPDF6");
+      if (pdfLHA == nullptr) return 1;
+      pdfLHA->init( 2212, lhapdfSet, 0, &logger);
+      int nCompare = nPoint / 10;
+      t0 = Clock::now();
+      double sumLHA = 0.;
+      for (int i = 0; i < nCompare; ++i)
+        sumLHA += pdfLHA->xf( 21, xPoint[i], Q2Point[i]);
+      double secLHA = std::chrono::duration<double>(Clock::now() - t0)
+        .count();
+      double diffMax = 0.;
+      for (int i = 0; i < nCompare; ++i) for (int id : idSum) {
+        double a = pdf.xf( id, xPoint[i], Q2Point[i]);
+        double b = pdfLHA->xf( id, xPoint[i], Q2Point[i]);
+        if (abs(b) > 1e-6) diffMax = max( diffMax, abs(a / b - 1.));
+      }
+      cout << "\n   LHAPDF6:      " << setw(6) << setprecision(2)
+           << 1e-6 * nCompare / secLHA << " M calls per second, largest "
+           << "relative difference " << scientific << setprecision(2)
+           << diffMax << fixed << ", mean xg " << sumLHA / nCompare;
+    }
+  }
+  cout << endl;
+
+  // Done.
+  return 0;
+}
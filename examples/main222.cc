@@ -68,6 +68,12 @@ int main() {
 
   });
 
+  // A run without any events does nothing, and returns a zero event
+  // count for each instance.
+  vector<long> nNoEvents = pythia.run(0, [](Pythia*) {});
+  for (long nEventsNow : nNoEvents)
+    if (nEventsNow != 0) return 1;
+
   // PythiaParallel::stat combines statistics for each Pythia instance.
   pythia.stat();
 
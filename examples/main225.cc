@@ -0,0 +1,63 @@
+// main225.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: parallelism; performance
+
+// Benchmark of the startup time of Pythia objects, which matters when
+// many instances are created, e.g. by PythiaParallel or Angantyr.
+// Compares the construction, which reads the binary database
+// PythiaDatabase.bin in the xmldoc directory when it is up to date
+// (built by "make" in the main directory), with reading all the XML
+// files, and with copying an existing instance.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of repetitions for each measurement.
+  int nRep = 20;
+  typedef std::chrono::steady_clock Clock;
+  auto msPerRep = [nRep](Clock::time_point t0, Clock::time_point t1) {
+    return 1e3 * std::chrono::duration<double>(t1 - t0).count() / nRep; };
+
+  // Construct new instances, from the binary database if up to date.
+  Clock::time_point t0 = Clock::now();
+  for (int iRep = 0; iRep < nRep; ++iRep) Pythia pythiaNew(
+    "../share/Pythia8/xmldoc", false);
+  Clock::time_point t1 = Clock::now();
+
+  // Read in all settings and particle data from the XML files.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  string xmlPath = pythia.settings.word("xmlPath");
+  Clock::time_point t2 = Clock::now();
+  for (int iRep = 0; iRep < nRep; ++iRep) {
+    pythia.settings.reInit(xmlPath + "Index.xml");
+    pythia.particleData.reInit(xmlPath + "ParticleData.xml");
+  }
+  pythia.settings.addWord("xmlPath", xmlPath);
+  Clock::time_point t3 = Clock::now();
+
+  // Copy an existing instance, as done by PythiaParallel.
+  for (int iRep = 0; iRep < nRep; ++iRep)
+    Pythia pythiaCopy(pythia.settings, pythia.particleData, false);
+  Clock::time_point t4 = Clock::now();
+
+  // Print results.
+  ifstream database((xmlPath + "PythiaDatabase.bin").c_str());
+  cout << fixed << setprecision(2)
+       << "\n Binary database in " << xmlPath << " "
+       << (database.good() ? "found" : "not found; run make to build it")
+       << "\n Time per construction      (ms): " << msPerRep(t0, t1)
+       << "\n Time per reading XML files (ms): " << msPerRep(t2, t3)
+       << "\n Time per copy construction (ms): " << msPerRep(t3, t4)
+       << "\n" << endl;
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,96 @@
+// main226.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: parallelism; event record; performance
+
+// Multithreaded benchmark of copying event records. An LHC event is
+// generated once, and is then shared between threads. Each thread
+// repeatedly copies the record, and rebuilds it entry by entry with
+// Event::append. All particles point to the same particle data entries,
+// so any per-particle reference counting on them would make the threads
+// contend for the same cache lines. The time per copy and rebuild is
+// shown for different numbers of threads. It is also checked that the
+// event can still be read after some particles have been redefined and
+// Pythia has been re-initialized, since the particles do not own the
+// particle data entries they point to.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+#include <thread>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of copies per thread, and numbers of threads.
+  int nCopy = 3000;
+  vector<int> nThreads = {1, 2, 4};
+  typedef std::chrono::steady_clock Clock;
+
+  // Generate one LHC minimum-bias event with many particles.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  pythia.readString("Beams:eCM = 13600.");
+  pythia.readString("SoftQCD:nonDiffractive = on");
+  pythia.readString("Print:quiet = on");
+  if (!pythia.init()) return 1;
+  Event event = pythia.event;
+  for (int iEvent = 0; iEvent < 20; ++iEvent)
+    if (pythia.next() && pythia.event.size() > event.size())
+      event = pythia.event;
+  const Event& eventShared = event;
+
+  // Redefine the most common particles and re-initialize. The event kept
+  // from before should still show the old properties.
+  vector<string> names;
+  vector<double> masses;
+  for (int i = 0; i < event.size(); ++i) {
+    names.push_back( event[i].name());
+    masses.push_back( event[i].m0());
+  }
+  for (const char* line : {"111:new = pi0 void 0 0 0 0.135",
+    "211:new = pi+ pi- 1 3 0 0.1396", "22:new = gamma void 2 0 0 0."})
+    pythia.readString(line);
+  if (!pythia.init()) return 1;
+  int nDiffer = 0;
+  for (int i = 0; i < event.size(); ++i)
+    if (event[i].name() != names[i] || event[i].m0() != masses[i])
+      ++nDiffer;
+  cout << "\n Particles read differently after re-initialization: "
+       << nDiffer << endl;
+
+  // Loop over numbers of threads.
+  cout << "\n Event with " << event.size() << " entries, " << nCopy
+       << " copies and rebuilds per thread:";
+  for (int nThread : nThreads) {
+    vector<int> nEntries(nThread, 0);
+    vector<std::thread> threads;
+    Clock::time_point t0 = Clock::now();
+    for (int iThread = 0; iThread < nThread; ++iThread)
+      threads.emplace_back( [&, iThread]() {
+        Event rebuilt;
+        rebuilt.init("(rebuilt)", &pythia.particleData);
+        for (int iCopy = 0; iCopy < nCopy; ++iCopy) {
+          Event copied = eventShared;
+          rebuilt.reset();
+          for (int i = 1; i < copied.size(); ++i) rebuilt.append(copied[i]);
+          nEntries[iThread] += rebuilt.size();
+        }
+      } );
+    for (std::thread& thread : threads) thread.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    int nSum = 0;
+    for (int n : nEntries) nSum += n;
+    cout << "\n   " << nThread << " thread(s): " << fixed << setprecision(1)
+         << setw(7) << 1e6 * seconds / nCopy
+         << " us wall time per copy and rebuild in each thread, "
+         << nSum / (nThread * nCopy) << " entries";
+  }
+  cout << endl;
+
+  // Done.
+  return (nDiffer == 0) ? 0 : 1;
+}
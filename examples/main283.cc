@@ -0,0 +1,84 @@
+// main283.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: particle data; performance
+
+// Micro-benchmark of particle data lookups, in lookups per second. The
+// codes of all particles in LHC minimum-bias events are collected, and
+// then looked up repeatedly, both with the hash index now used by
+// ParticleData and in an ordered map with shared pointers, as was used
+// before. Also some of the per-code methods called by the showers,
+// hadronization and decays are timed.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events, and number of times their codes are looked up.
+  int nEvent  = 100;
+  int nRepeat = 20;
+  typedef std::chrono::steady_clock Clock;
+
+  // Generate events and collect the codes of all particles in them.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  pythia.readString("Beams:eCM = 13600.");
+  pythia.readString("SoftQCD:nonDiffractive = on");
+  pythia.readString("Print:quiet = on");
+  if (!pythia.init()) return 1;
+  vector<int> ids;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+    for (int i = 1; i < pythia.event.size(); ++i)
+      ids.push_back(pythia.event[i].id());
+  }
+  ParticleData& pd = pythia.particleData;
+
+  // Copy of the particle data map, as looked up before.
+  map<int, ParticleDataEntryPtr> pdtMap;
+  for (int id = 1; id != 0; id = pd.nextId(id))
+    pdtMap[id] = pd.particleDataEntryPtr(id);
+
+  // The different ways of looking up, each giving a number to sum.
+  vector<string> names = {"map find (before)", "findParticle",
+    "findEntry", "isParticle", "m0", "isHadron", "charge"};
+  vector< function<double(int)> > lookups = {
+    [&](int id) {
+      auto found = pdtMap.find(abs(id));
+      ParticleDataEntryPtr ptr = (found != pdtMap.end()
+        && (id > 0 || found->second->hasAnti())) ? found->second : nullptr;
+      return (ptr) ? ptr->m0() : 0.; },
+    [&](int id) { ParticleDataEntryPtr ptr = pd.findParticle(id);
+      return (ptr) ? ptr->m0() : 0.; },
+    [&](int id) { ParticleDataEntry* ptr = pd.findEntry(id);
+      return (ptr) ? ptr->m0() : 0.; },
+    [&](int id) { return pd.isParticle(id) ? 1. : 0.; },
+    [&](int id) { return pd.m0(id); },
+    [&](int id) { return pd.isHadron(id) ? 1. : 0.; },
+    [&](int id) { return pd.charge(id); } };
+
+  // Time each of them, and check that the sums agree where they should.
+  cout << "\n LHC minimum bias, " << ids.size() << " particle codes "
+       << "looked up " << nRepeat << " times:";
+  for (int iLookup = 0; iLookup < int(lookups.size()); ++iLookup) {
+    double sum = 0.;
+    Clock::time_point t0 = Clock::now();
+    for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat)
+      for (int id : ids) sum += lookups[iLookup](id);
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    cout << fixed << setprecision(0) << "\n   " << left << setw(20)
+         << names[iLookup] << right << ": " << setw(12)
+         << nRepeat * ids.size() / seconds << " lookups per second, sum "
+         << setprecision(2) << setw(14) << sum / nRepeat;
+  }
+  cout << endl;
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,75 @@
+// main284.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: settings; performance
+
+// Benchmark of access to the settings database. The time per call of the
+// ordinary flag, mode and parm methods, which look up the setting by name,
+// is compared with that of handles obtained once by flagHandle, modeHandle
+// and parmHandle. Also the initialization time of a large setup, with
+// many process groups and SUSY switched on, is shown.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of calls of each kind.
+  int nCall = 2000000;
+  typedef std::chrono::steady_clock Clock;
+
+  // Large setup with many processes.
+  vector<string> setup = {"Beams:eCM = 13000.", "HardQCD:all = on",
+    "PromptPhoton:all = on", "WeakSingleBoson:all = on",
+    "WeakDoubleBoson:all = on", "WeakBosonAndParton:all = on",
+    "Top:all = on", "HiggsSM:all = on", "Charmonium:all = on",
+    "Bottomonium:all = on", "PhotonParton:all = on",
+    "SLHA:file = sps1aWithDecays.spc", "SLHA:verbose = 0", "SUSY:all = on",
+    "PhaseSpace:pTHatMin = 50.", "Print:quiet = on"};
+
+  // Time the initialization.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  for (const string& line : setup) pythia.readString(line);
+  Clock::time_point t0 = Clock::now();
+  if (!pythia.init()) return 1;
+  double secondsInit = std::chrono::duration<double>(Clock::now() - t0)
+    .count();
+  cout << "\n Pythia::init for all SM and SUSY process groups: " << fixed
+       << setprecision(3) << secondsInit << " s";
+
+  // Access by name and by handle.
+  Settings& settings = pythia.settings;
+  SettingHandle<bool>   flagNow = settings.flagHandle("HadronLevel:all");
+  SettingHandle<int>    modeNow = settings.modeHandle("Tune:pp");
+  SettingHandle<double> parmNow = settings.parmHandle("Beams:eCM");
+  vector<string> names = {"flag by name", "flag by handle", "mode by name",
+    "mode by handle", "parm by name", "parm by handle"};
+  vector< function<double()> > accesses = {
+    [&]() { return settings.flag("HadronLevel:all") ? 1. : 0.; },
+    [&]() { return flagNow() ? 1. : 0.; },
+    [&]() { return double(settings.mode("Tune:pp")); },
+    [&]() { return double(modeNow()); },
+    [&]() { return settings.parm("Beams:eCM"); },
+    [&]() { return parmNow(); } };
+
+  // Time each of them.
+  for (int iAccess = 0; iAccess < int(accesses.size()); ++iAccess) {
+    double sum = 0.;
+    t0 = Clock::now();
+    for (int iCall = 0; iCall < nCall; ++iCall) sum += accesses[iAccess]();
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    cout << "\n   " << left << setw(15) << names[iAccess] << right << ": "
+         << setprecision(1) << setw(7) << 1e9 * seconds / nCall
+         << " ns per call, value " << setprecision(1) << sum / nCall;
+  }
+  cout << endl;
+
+  // Done.
+  return 0;
+}
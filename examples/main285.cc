@@ -0,0 +1,127 @@
+// main285.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: random numbers; performance
+
+// Benchmark of the random number generation speed, in numbers per second.
+// The standard Marsaglia-Zaman-Tsang generator is used one number at a
+// time and in batches, for flat, exponential and Gaussian distributions,
+// and is compared with the MixMax generator, used as an external engine.
+// It is also checked that batches give the same numbers as single calls,
+// and that no buffered numbers are handed out after a switch of engine.
+
+#include "Pythia8/Pythia.h"
+#include "Pythia8Plugins/MixMax.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of random numbers, and size of each batch.
+  int nNumber = 50000000;
+  int nBatch  = 1000;
+  typedef std::chrono::steady_clock Clock;
+  vector<double> batch(nBatch);
+
+  // The different ways of generating, each returning a sum of numbers.
+  Rndm rndm(Rndm::DEFAULTSEED);
+  Rndm rndmMixMax(Rndm::DEFAULTSEED);
+  rndmMixMax.rndmEnginePtr(make_shared<MixMaxRndm>(0, 0, 0, 123));
+  vector<string> names = {"flat()", "flatBatch", "exp()", "expBatch",
+    "gauss()", "gaussBatch", "MixMax flat()"};
+  vector< function<double()> > generators = {
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; ++i) sum += rndm.flat();
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; i += nBatch) {
+        rndm.flatBatch(batch.data(), nBatch);
+        for (double x : batch) sum += x;
+      }
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; ++i) sum += rndm.exp();
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; i += nBatch) {
+        rndm.expBatch(batch.data(), nBatch);
+        for (double x : batch) sum += x;
+      }
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; ++i) sum += rndm.gauss();
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; i += nBatch) {
+        rndm.gaussBatch(batch.data(), nBatch);
+        for (double x : batch) sum += x;
+      }
+      return sum; },
+    [&]() { double sum = 0.;
+      for (int i = 0; i < nNumber; ++i) sum += rndmMixMax.flat();
+      return sum; } };
+
+  // Time each of them. Single calls and batches start from the same
+  // state, so that they should give the same sum.
+  cout << "\n " << nNumber << " random numbers, batches of " << nBatch
+       << ":";
+  for (int iGen = 0; iGen < int(generators.size()); ++iGen) {
+    rndm.init(Rndm::DEFAULTSEED);
+    Clock::time_point t0 = Clock::now();
+    double sum = generators[iGen]();
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    cout << fixed << setprecision(1) << "\n   " << left << setw(14)
+         << names[iGen] << right << ": " << setw(6) << 1e-6 * nNumber
+         << " / " << setprecision(3) << seconds << " s = " << setw(7)
+         << setprecision(1) << 1e-6 * nNumber / seconds
+         << " M numbers per second, mean " << setprecision(6)
+         << sum / nNumber;
+  }
+  cout << endl;
+
+  // Check that batches reproduce single calls, also after some single
+  // calls have left numbers in the internal buffer.
+  Rndm rndm1(Rndm::DEFAULTSEED);
+  Rndm rndm2(Rndm::DEFAULTSEED);
+  int nDiffer = 0;
+  for (int iTry = 0; iTry < 1000; ++iTry) {
+    int nSingle = int(100. * rndm1.flat());
+    rndm2.flat();
+    for (int i = 0; i < nSingle; ++i) rndm1.flat();
+    for (int i = 0; i < nSingle; ++i) rndm2.flat();
+    int n = 1 + int(200. * rndm1.flat());
+    rndm2.flat();
+    int type = iTry % 3;
+    if (type == 0) rndm2.flatBatch(batch.data(), n);
+    else if (type == 1) rndm2.expBatch(batch.data(), n);
+    else rndm2.gaussBatch(batch.data(), n);
+    for (int i = 0; i < n; ++i) {
+      double single = (type == 0) ? rndm1.flat()
+        : ((type == 1) ? rndm1.exp() : rndm1.gauss());
+      if (single != batch[i]) ++nDiffer;
+    }
+  }
+  if (!(rndm1.getState() == rndm2.getState())) ++nDiffer;
+  cout << "\n Batches compared with single calls: " << nDiffer
+       << " differences";
+
+  // After a switch to an external engine only its numbers are used.
+  Rndm rndm3(Rndm::DEFAULTSEED);
+  rndm3.flat();
+  rndm3.rndmEnginePtr(make_shared<MixMaxRndm>(0, 0, 0, 123));
+  MixMaxRndm mixMax(0, 0, 0, 123);
+  int nBuffered = 0;
+  for (int i = 0; i < 100; ++i) if (rndm3.flat() != mixMax.flat())
+    ++nBuffered;
+  cout << "\n Numbers not from the new engine after a switch: " << nBuffered
+       << endl;
+  nDiffer += nBuffered;
+
+  // Done.
+  return (nDiffer == 0) ? 0 : 1;
+}
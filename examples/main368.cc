@@ -0,0 +1,132 @@
+// main368.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: B decays; performance
+
+// Benchmark of the particle decay speed, in decays per second, with the
+// decay channel picked by a linear search over all channels and by alias
+// tables, ParticleData:aliasTables = off or on. Undecayed LHC bbbar events
+// are generated once, and then decayed repeatedly by two instances,
+// one for each option. Also the B hadron decays are counted separately,
+// since these have many channels each. Finally it is checked that the
+// decays of an instance with a copy of the particle data, with alias
+// tables, follow a branching ratio changed in the copy only.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events, and number of times each of them is decayed.
+  int nEvent  = 2000;
+  int nRepeat = 10;
+  typedef std::chrono::steady_clock Clock;
+
+  // Generate undecayed bbbar events.
+  Pythia pythiaGen("../share/Pythia8/xmldoc", false);
+  pythiaGen.readString("Beams:eCM = 13600.");
+  pythiaGen.readString("HardQCD:hardbbbar = on");
+  pythiaGen.readString("PhaseSpace:pTHatMin = 20.");
+  pythiaGen.readString("HadronLevel:Decay = off");
+  pythiaGen.readString("Print:quiet = on");
+  if (!pythiaGen.init()) return 1;
+  vector<Event> events;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent)
+    if (pythiaGen.next()) events.push_back(pythiaGen.event);
+
+  // Set up instances with linear search and with alias tables.
+  Pythia pythiaOff("../share/Pythia8/xmldoc", false);
+  Pythia pythiaOn("../share/Pythia8/xmldoc", false);
+  Pythia* pythias[2] = {&pythiaOff, &pythiaOn};
+  for (int iAlias = 0; iAlias < 2; ++iAlias) {
+    pythias[iAlias]->readString("ProcessLevel:all = off");
+    pythias[iAlias]->readString("Print:quiet = on");
+    pythias[iAlias]->readString(string("ParticleData:aliasTables = ")
+      + (iAlias == 1 ? "on" : "off"));
+    if (!pythias[iAlias]->init()) return 1;
+  }
+
+  // Decay the events, alternating between the two instances, so that
+  // both are equally affected by varying conditions of the machine.
+  long   nDecay[2]  = {0, 0};
+  long   nDecayB[2] = {0, 0};
+  double seconds[2] = {0., 0.};
+  for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat)
+  for (int iAlias = 0; iAlias < 2; ++iAlias) {
+    Pythia& pythia = *pythias[iAlias];
+    Clock::time_point t0 = Clock::now();
+    for (const Event& event : events) {
+      // Copied events point to the particle data of pythiaGen; redirect.
+      pythia.event = event;
+      pythia.event.init("(complete event)", &pythia.particleData);
+      pythia.event.restorePtrs();
+      if (!pythia.moreDecays()) continue;
+      for (int i = 0; i < pythia.event.size(); ++i) {
+        int iDau = pythia.event[i].daughter1();
+        if (pythia.event[i].isFinal() || iDau <= 0) continue;
+        int statusDau = pythia.event[iDau].statusAbs();
+        if (statusDau < 91 || statusDau > 94) continue;
+        ++nDecay[iAlias];
+        if (abs(pythia.event[i].particleDataEntry().heaviestQuark()) == 5)
+          ++nDecayB[iAlias];
+      }
+    }
+    seconds[iAlias] += std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+  }
+
+  // Print result.
+  double nTot = nRepeat * events.size();
+  cout << "\n LHC bbbar, " << events.size() << " events decayed "
+       << nRepeat << " times each:";
+  for (int iAlias = 0; iAlias < 2; ++iAlias)
+    cout << fixed << setprecision(0) << "\n   aliasTables = "
+         << (iAlias == 1 ? "on " : "off") << ": " << setw(10)
+         << nDecay[iAlias] / seconds[iAlias] << " decays per second, "
+         << setprecision(2) << nDecay[iAlias] / nTot << " per event, of "
+         << "which " << nDecayB[iAlias] / nTot << " B hadron decays";
+  cout << endl;
+
+  // Fraction of K_S0 decays to pi0 pi0 in an instance.
+  auto fracPi0 = [](Pythia& pythia) {
+    int nPi0 = 0;
+    int nTry = 20000;
+    double m0 = pythia.particleData.m0(310);
+    for (int iTry = 0; iTry < nTry; ++iTry) {
+      pythia.event.reset();
+      pythia.event.append( 310, 1, 0, 0, 0, 0, 0, 0, 0., 0., 0., m0, m0);
+      if (!pythia.moreDecays()) continue;
+      int iDau = pythia.event[1].daughter1();
+      if (iDau > 0 && pythia.event[iDau].id() == 111) ++nPi0;
+    }
+    return double(nPi0) / nTry;
+  };
+
+  // Copy the particle data of the instance with alias tables, and change
+  // the K_S0 branching ratios in the copy, after its tables are set up.
+  Pythia pythiaCopy( pythiaOn.settings, pythiaOn.particleData, false);
+  if (!pythiaCopy.init()) return 1;
+  double fracBef = fracPi0( pythiaCopy);
+  ParticleDataEntryPtr kShortPtr
+    = pythiaCopy.particleData.particleDataEntryPtr(310);
+  for (int i = 0; i < kShortPtr->sizeChannels(); ++i) {
+    DecayChannel& channel = kShortPtr->channel(i);
+    bool isPi0Pi0 = channel.multiplicity() == 2
+      && channel.product(0) == 111 && channel.product(1) == 111;
+    channel.bRatio( isPi0Pi0 ? 1. : 0.);
+  }
+  double fracCopy = fracPi0( pythiaCopy);
+  double fracOrig = fracPi0( pythiaOn);
+  cout << setprecision(3) << "\n Fraction of K_S0 -> pi0 pi0: "
+       << fracBef << " before and " << fracCopy << " after the change in "
+       << "the copy, " << fracOrig << " in the original" << endl;
+  bool followsBR = fracCopy > 0.999 && abs(fracOrig - fracBef) < 0.02;
+
+  // Done.
+  return (followsBR) ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+// main409.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: parton shower; performance; validation
+
+// Regression test of the TimeShower:cacheTrials option. Parton-level
+// distributions are generated with the option off and on, for e+e- -> Z
+// and for QCD jets at the LHC, and compared bin by bin. Since individual
+// events differ, the chi2 of the off-vs-on comparison is shown together
+// with that of two off runs with different seeds, which sets the scale of
+// statistical fluctuations. Also the time per event is shown.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+// Chi2 between two histograms with unit-weight entries, and number of
+// bins with entries.
+
+pair<double,int> chi2(const Hist& h1, const Hist& h2) {
+  double chi2Sum = 0.;
+  int nDof = 0;
+  for (int iBin = 1; iBin <= h1.getBinNumber(); ++iBin) {
+    double n1 = h1.getBinContent(iBin);
+    double n2 = h2.getBinContent(iBin);
+    if (n1 + n2 <= 0.) continue;
+    chi2Sum += pow2(n1 - n2) / (n1 + n2);
+    ++nDof;
+  }
+  return make_pair(chi2Sum, nDof);
+}
+
+//==========================================================================
+
+int main() {
+
+  // Setups to compare, and number of events for each.
+  typedef std::chrono::steady_clock Clock;
+  vector<string> setupNames = {"e+e- -> Z -> partons", "LHC QCD jets"};
+  vector< vector<string> > setups = {
+    {"Beams:idA = 11", "Beams:idB = -11", "Beams:eCM = 91.1876",
+     "WeakSingleBoson:ffbar2gmZ = on", "23:onMode = off",
+     "23:onIfAny = 1 2 3 4 5", "PDF:lepton = off"},
+    {"Beams:eCM = 13000.", "HardQCD:all = on",
+     "PhaseSpace:pTHatMin = 200."} };
+  vector<int> nEvents = {20000, 2000};
+
+  // Runs: cache off, cache off with another seed, and cache on.
+  vector<string> runNames = {"off", "off, other seed", "on"};
+  vector<string> runCache = {"off", "off", "on"};
+
+  // Loop over setups and runs.
+  for (int iSetup = 0; iSetup < int(setups.size()); ++iSetup) {
+    vector<Hist> nParton, pTGluon, xGluon;
+    vector<double> secPerEvent;
+    for (int iRun = 0; iRun < int(runNames.size()); ++iRun) {
+      Pythia pythia("../share/Pythia8/xmldoc", false);
+      for (const string& line : setups[iSetup]) pythia.readString(line);
+      pythia.readString("HadronLevel:all = off");
+      pythia.readString("Random:setSeed = on");
+      pythia.readString("Random:seed = " + to_string(iRun + 1));
+      pythia.readString("TimeShower:cacheTrials = " + runCache[iRun]);
+      pythia.readString("Print:quiet = on");
+      if (!pythia.init()) return 1;
+      nParton.push_back( Hist("number of final partons", 100, -0.5,
+        (iSetup == 0) ? 99.5 : 399.5));
+      pTGluon.push_back( Hist("log10(pT) of final gluons", 40, -0.5,
+        (iSetup == 0) ? 1.5 : 3.5));
+      xGluon.push_back( Hist("energy fraction of final gluons", 40, 0., 1.));
+
+      // Event loop.
+      Clock::time_point t0 = Clock::now();
+      for (int iEvent = 0; iEvent < nEvents[iSetup]; ++iEvent) {
+        if (!pythia.next()) continue;
+        Event& event = pythia.event;
+        int nFinal = 0;
+        double eGluon = 0.;
+        double eSum   = 0.;
+        for (int i = 0; i < event.size(); ++i) if (event[i].isFinal()) {
+          if (!event[i].isParton()) continue;
+          ++nFinal;
+          eSum += event[i].e();
+          if (event[i].id() != 21) continue;
+          pTGluon.back().fill( log10(max( 1e-3, event[i].pT())));
+          eGluon += event[i].e();
+        }
+        nParton.back().fill( nFinal);
+        if (eSum > 0.) xGluon.back().fill( eGluon / eSum);
+      }
+      secPerEvent.push_back( std::chrono::duration<double>(Clock::now()
+        - t0).count() / nEvents[iSetup]);
+    }
+
+    // Compare each run with the first one.
+    cout << "\n " << setupNames[iSetup] << ", " << nEvents[iSetup]
+         << " events per run:";
+    for (int iRun = 1; iRun < int(runNames.size()); ++iRun) {
+      pair<double,int> chiN = chi2( nParton[0], nParton[iRun]);
+      pair<double,int> chiPT = chi2( pTGluon[0], pTGluon[iRun]);
+      pair<double,int> chiX = chi2( xGluon[0], xGluon[iRun]);
+      cout << "\n   off vs " << left << setw(16) << runNames[iRun] << right
+           << fixed << setprecision(1) << ": chi2/ndf partons "
+           << chiN.first << "/" << chiN.second << ", gluon pT "
+           << chiPT.first << "/" << chiPT.second << ", gluon energy "
+           << chiX.first << "/" << chiX.second;
+    }
+    for (int iRun = 0; iRun < int(runNames.size()); ++iRun)
+      cout << "\n   cache " << left << setw(17) << runNames[iRun] << right
+           << ": <n partons> " << setprecision(2) << setw(7)
+           << nParton[iRun].getXMean() << ", time per event "
+           << setprecision(3) << 1e3 * secPerEvent[iRun] << " ms";
+    cout << endl;
+  }
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,116 @@
+// main426.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: heavy ions; Bose-Einstein; performance
+
+// Benchmark of the Bose-Einstein shifts in p-Pb collisions, generated
+// with the Angantyr model. Parton-level events are generated once, and
+// are then hadronized by instances without Bose-Einstein effects, with
+// them for all pairs of identical hadrons, and with them only for pairs
+// below a few values of BoseEinstein:QMaxPair. The time spent on the
+// Bose-Einstein step is obtained from the difference to the first one.
+// Since all instances use the same random numbers, the shifted momenta
+// can also be compared hadron by hadron with the all-pairs ones.
+// Note that in high-multiplicity events, notably Pb-Pb ones, the energy
+// compensation step of the algorithm often fails to converge, and then
+// no shifts are made. Therefore the number of shifted events is shown.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events. Values of QMaxPair, where 0 means all pairs.
+  int nEvent = 100;
+  vector<double> QMaxPairs = {0., 8., 4., 2.};
+  typedef std::chrono::steady_clock Clock;
+
+  // Common setup of p-Pb collisions with Angantyr.
+  vector<string> setup = {"Beams:idA = 2212", "Beams:idB = 1000822080",
+    "Beams:eA = 4000", "Beams:eB = 1570", "Beams:frameType = 2",
+    "HeavyIon:SigFitNGen = 0", "HeavyIon:SigFitDefPar = 2.15,17.24,0.33",
+    "Check:event = off", "Print:quiet = on"};
+
+  // Generate parton-level events.
+  Pythia pythiaGen("../share/Pythia8/xmldoc", false);
+  for (const string& line : setup) pythiaGen.readString(line);
+  pythiaGen.readString("HadronLevel:all = off");
+  if (!pythiaGen.init()) return 1;
+  vector<Event> events;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent)
+    if (pythiaGen.next()) events.push_back(pythiaGen.event);
+
+  // Hadronize without Bose-Einstein and then with the different options.
+  double secondsNoBE = 0.;
+  vector< vector<Vec4> > pShiftedAll(events.size());
+  cout << "\n p-Pb at 5.02 TeV, " << events.size() << " events:";
+  for (int iCase = -1; iCase < int(QMaxPairs.size()); ++iCase) {
+    Pythia pythia("../share/Pythia8/xmldoc", false);
+    for (const string& line : setup) pythia.readString(line);
+    pythia.readString("ProcessLevel:all = off");
+    if (iCase >= 0) {
+      pythia.readString("HadronLevel:BoseEinstein = on");
+      pythia.settings.parm("BoseEinstein:QMaxPair", QMaxPairs[iCase]);
+    }
+    if (!pythia.init()) return 1;
+
+    // Time hadronization, and compare shifted momenta with all pairs.
+    int  nEventShifted = 0;
+    long nShifted = 0;
+    long nCompared = 0;
+    double pDiffSum = 0.;
+    double pShiftSum = 0.;
+    Clock::time_point t0 = Clock::now();
+    for (int iEvent = 0; iEvent < int(events.size()); ++iEvent) {
+      // Copied events point to the particle data of pythiaGen; redirect.
+      pythia.event = events[iEvent];
+      pythia.event.init("(complete event)", &pythia.particleData);
+      pythia.event.restorePtrs();
+      if (!pythia.forceHadronLevel(false)) continue;
+      if (iCase < 0) continue;
+      vector<Vec4> pShifted;
+      for (int i = 0; i < pythia.event.size(); ++i)
+      if (pythia.event[i].status() == 99) {
+        pShifted.push_back(pythia.event[i].p());
+        pShiftSum += (pythia.event[i].p()
+          - pythia.event[pythia.event[i].mother1()].p()).pAbs();
+      }
+      if (pShifted.size() > 0) ++nEventShifted;
+      nShifted += pShifted.size();
+      if (iCase == 0) pShiftedAll[iEvent] = pShifted;
+      else if (pShifted.size() > 0
+        && pShifted.size() == pShiftedAll[iEvent].size()) {
+        nCompared += pShifted.size();
+        for (int j = 0; j < int(pShifted.size()); ++j)
+          pDiffSum += (pShifted[j] - pShiftedAll[iEvent][j]).pAbs();
+      }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+
+    // Print result.
+    if (iCase < 0) {
+      secondsNoBE = seconds;
+      cout << fixed << setprecision(4) << "\n   no Bose-Einstein:      "
+           << seconds / events.size() << " s per event for hadronization";
+      continue;
+    }
+    if (iCase == 0) cout << "\n   all pairs:             ";
+    else cout << "\n   QMaxPair = " << setprecision(1) << setw(4)
+              << QMaxPairs[iCase] << " GeV:   ";
+    cout << setprecision(4) << (seconds - secondsNoBE) / events.size()
+         << " s per event for Bose-Einstein, shifts in " << nEventShifted
+         << " events, <|dp|> = " << pShiftSum / max(1L, nShifted) << " GeV";
+    if (iCase > 0) cout << ", <|dp - dp(all)|> = "
+         << pDiffSum / max(1L, nCompared) << " GeV";
+  }
+  cout << endl;
+
+  // Done.
+  return 0;
+}
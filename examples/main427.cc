@@ -0,0 +1,158 @@
+// main427.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: heavy ions; event record; performance; validation
+
+// Benchmark and test of the checkpoints of the event record, which are
+// used in retry loops instead of full copies of the record. A p-Pb
+// parton-level event is generated with the Angantyr model. Then a retry
+// that reads all entries but changes only a given number of them is
+// timed, once with a full copy of the record that is assigned back, and
+// once with a checkpoint that is restored. Only the changed entries are
+// logged. Finally random sequences of modifications, reads, nested
+// checkpoints, restores and clears are compared with full copies. Note
+// that a restore keeps the checkpoint, so that a retry can be restored
+// again, until the checkpoint is cleared.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+// Check that two four-vectors, and two event records entry by entry,
+// agree exactly.
+
+bool sameVec(const Vec4& v1, const Vec4& v2) {
+  return v1.px() == v2.px() && v1.py() == v2.py() && v1.pz() == v2.pz()
+    && v1.e() == v2.e();
+}
+
+bool sameEvent(const Event& event1, const Event& event2) {
+  if (event1.size() != event2.size()) return false;
+  if (event1.sizeJunction() != event2.sizeJunction()) return false;
+  for (int i = 0; i < event1.size(); ++i) {
+    const Particle& p1 = event1[i];
+    const Particle& p2 = event2[i];
+    if (p1.id() != p2.id() || p1.status() != p2.status()
+      || p1.mother1() != p2.mother1() || p1.mother2() != p2.mother2()
+      || p1.daughter1() != p2.daughter1() || p1.daughter2() != p2.daughter2()
+      || p1.col() != p2.col() || p1.acol() != p2.acol()
+      || !sameVec( p1.p(), p2.p()) || p1.m() != p2.m()
+      || p1.scale() != p2.scale() || !sameVec( p1.vProd(), p2.vProd()))
+      return false;
+  }
+  return true;
+}
+
+//==========================================================================
+
+int main() {
+
+  // Number of retries timed, and number of random operations tested.
+  int nRetry = 2000;
+  int nOperation = 200000;
+  vector<int> nTouches = {10, 100, 1000};
+  typedef std::chrono::steady_clock Clock;
+
+  // Generate p-Pb parton-level events with Angantyr, and keep the largest.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  for (const char* line : {"Beams:idA = 2212", "Beams:idB = 1000822080",
+    "Beams:eA = 4000", "Beams:eB = 1570", "Beams:frameType = 2",
+    "HeavyIon:SigFitNGen = 0", "HeavyIon:SigFitDefPar = 2.15,17.24,0.33",
+    "HadronLevel:all = off", "Check:event = off", "Print:quiet = on"})
+    pythia.readString(line);
+  if (!pythia.init()) return 1;
+  Event event = pythia.event;
+  for (int iEvent = 0; iEvent < 20; ++iEvent)
+    if (pythia.next() && pythia.event.size() > event.size())
+      event = pythia.event;
+  Rndm& rndm = pythia.rndm;
+
+  // Time retries that read all entries, change nTouch of them, and are
+  // then undone.
+  cout << "\n p-Pb parton-level event with " << event.size()
+       << " entries, time per retry:";
+  double pxSum = 0.;
+  for (int nTouch : nTouches) {
+    Clock::time_point t0 = Clock::now();
+    for (int iRetry = 0; iRetry < nRetry; ++iRetry) {
+      Event eventSave = event;
+      for (int i = 0; i < event.size(); ++i) pxSum += event[i].px();
+      for (int i = 0; i < nTouch; ++i)
+        event[1 + (i * 7) % (event.size() - 1)].scale( 1.);
+      event = eventSave;
+    }
+    double secCopy = std::chrono::duration<double>(Clock::now() - t0)
+      .count() / nRetry;
+    t0 = Clock::now();
+    for (int iRetry = 0; iRetry < nRetry; ++iRetry) {
+      event.saveCheckpoint();
+      for (int i = 0; i < event.size(); ++i) pxSum += event[i].px();
+      for (int i = 0; i < nTouch; ++i)
+        event[1 + (i * 7) % (event.size() - 1)].scale( 1.);
+      event.restoreCheckpoint();
+      event.clearCheckpoint();
+    }
+    double secCheck = std::chrono::duration<double>(Clock::now() - t0)
+      .count() / nRetry;
+    cout << fixed << "\n   " << setw(4) << nTouch << " entries changed: "
+         << "full copy " << setprecision(1) << setw(7) << 1e6 * secCopy
+         << " us, checkpoint " << setprecision(2) << setw(7)
+         << 1e6 * secCheck << " us";
+  }
+
+  // Random operations, with full copies at each checkpoint level.
+  vector<Event> copies;
+  int nRestore = 0;
+  int nFail = 0;
+  for (int iOperation = 0; iOperation < nOperation; ++iOperation) {
+    int iOp = int(10. * rndm.flat());
+    int iEntry = 1 + int((event.size() - 1) * rndm.flat());
+    int jEntry = 1 + int((event.size() - 1) * rndm.flat());
+    if (iOp == 0 || iOp == 1)
+      event[iEntry].p( 1.001 * event[iEntry].p());
+    else if (iOp == 2)
+      event[iEntry].status( -event[iEntry].statusAbs());
+    else if (iOp == 3 && event.size() < 4000)
+      event.append( event[iEntry]);
+    else if (iOp == 3 && event.size() > 100)
+      event.popBack( 1 + int(10. * rndm.flat()));
+    else if (iOp == 4 && rndm.flat() < 0.01)
+      event.rot( 0.1, 0.2);
+    else if (iOp == 5 && copies.size() < 5) {
+      copies.push_back( event);
+      event.saveCheckpoint();
+    } else if (iOp == 6 && copies.size() > 0) {
+      event.restoreCheckpoint();
+      if (!sameEvent( event, copies.back())) ++nFail;
+      ++nRestore;
+      if (rndm.flat() < 0.5) {
+        event.clearCheckpoint();
+        copies.pop_back();
+      }
+    } else if (iOp == 7 && copies.size() > 0) {
+      event.clearCheckpoint();
+      copies.pop_back();
+    } else if (iOp == 8)
+      event[iEntry] = event[jEntry];
+    else if (iOp == 9)
+      for (Particle& pt : event) pxSum += pt.px();
+  }
+  while (copies.size() > 0) {
+    event.restoreCheckpoint();
+    if (!sameEvent( event, copies.back())) ++nFail;
+    ++nRestore;
+    event.clearCheckpoint();
+    copies.pop_back();
+  }
+  if (event.sizeCheckpoint() != 0) ++nFail;
+  cout << "\n Random operations: " << nRestore << " restores compared "
+       << "with full copies, " << nFail << " failed" << endl;
+  if (pxSum == 0.) cout << " Vanishing sum of px" << endl;
+
+  // Done.
+  return (nFail == 0) ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+// main444.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: hadronization; performance
+
+// Benchmark of the string fragmentation speed, in hadrons per second,
+// with the standard selection of the Lund fragmentation function and
+// with the tabulated one, StringZ:useTable = on. Parton-level events
+// are generated once, for LEP Z0 and for LHC minimum-bias, and are then
+// hadronized (without decays) by two instances, one for each option.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events per setup.
+  int nEvent = 5000;
+  typedef std::chrono::steady_clock Clock;
+
+  // The two setups: LEP Z0 to hadrons and LHC minimum bias.
+  vector<string> names = {"LEP Z0", "LHC minimum bias"};
+  vector< vector<string> > setups = {
+    {"Beams:idA = 11", "Beams:idB = -11", "Beams:eCM = 91.1876",
+     "WeakSingleBoson:ffbar2gmZ = on", "23:onMode = off",
+     "23:onIfAny = 1 2 3 4 5", "PDF:lepton = off"},
+    {"Beams:eCM = 13600.", "SoftQCD:nonDiffractive = on"} };
+
+  for (int iSetup = 0; iSetup < int(setups.size()); ++iSetup) {
+
+    // Generate parton-level events.
+    Pythia pythiaGen("../share/Pythia8/xmldoc", false);
+    for (const string& line : setups[iSetup]) pythiaGen.readString(line);
+    pythiaGen.readString("HadronLevel:all = off");
+    pythiaGen.readString("Print:quiet = on");
+    if (!pythiaGen.init()) return 1;
+    vector<Event> events;
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent)
+      if (pythiaGen.next()) events.push_back(pythiaGen.event);
+
+    // Hadronize them without and with tables.
+    cout << "\n " << names[iSetup] << ", " << events.size() << " events:";
+    for (int iTable = 0; iTable < 2; ++iTable) {
+      Pythia pythia("../share/Pythia8/xmldoc", false);
+      for (const string& line : setups[iSetup]) pythia.readString(line);
+      pythia.readString("ProcessLevel:all = off");
+      pythia.readString("Print:quiet = on");
+      pythia.readString("HadronLevel:Decay = off");
+      pythia.readString(string("StringZ:useTable = ")
+        + (iTable == 1 ? "on" : "off"));
+      if (!pythia.init()) return 1;
+      long nHadron = 0;
+      Clock::time_point t0 = Clock::now();
+      for (const Event& event : events) {
+        pythia.event = event;
+        if (!pythia.forceHadronLevel(false)) continue;
+        for (int i = 0; i < pythia.event.size(); ++i)
+          if (pythia.event[i].isFinal() && pythia.event[i].isHadron())
+            ++nHadron;
+      }
+      double seconds = std::chrono::duration<double>(Clock::now() - t0)
+        .count();
+      cout << fixed << setprecision(0) << "\n   useTable = "
+           << (iTable == 1 ? "on " : "off") << ": " << setw(10)
+           << nHadron / seconds << " hadrons per second, "
+           << setprecision(2) << double(nHadron) / events.size()
+           << " per event";
+    }
+    cout << endl;
+  }
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,117 @@
+// main445.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: colour reconnection; performance
+
+// Benchmark of the QCD-based colour reconnection model,
+// ColourReconnection:mode = 1, with all combinations of dipoles tried
+// and with only those close enough in rapidity to be causally connected,
+// ColourReconnection:searchByRapidity = off or on. Parton-level events
+// without reconnection are generated once, for LHC minimum-bias pp and
+// for p-Pb, and are then reconnected by two instances, one for each option,
+// with the hadronization switched off. The number of dipole combinations
+// tried is shown, and also whether the two give the same colours.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events per setup.
+  int nEvent = 200;
+  typedef std::chrono::steady_clock Clock;
+
+  // Colour reconnection model, with accompanying tune.
+  vector<string> crSetup = {"ColourReconnection:mode = 1",
+    "ColourReconnection:allowDoubleJunRem = off",
+    "ColourReconnection:m0 = 0.3", "ColourReconnection:allowJunctions = on",
+    "ColourReconnection:junctionCorrection = 1.20",
+    "ColourReconnection:timeDilationMode = 2",
+    "ColourReconnection:timeDilationPar = 0.18",
+    "StringPT:sigma = 0.335", "StringZ:aLund = 0.36",
+    "StringZ:bLund = 0.56", "StringFlav:probQQtoQ = 0.078",
+    "StringFlav:ProbStoUD = 0.2",
+    "StringFlav:probQQ1toQQ0join = 0.0275,0.0275,0.0275,0.0275",
+    "MultiPartonInteractions:pT0Ref = 2.15",
+    "BeamRemnants:remnantMode = 1", "BeamRemnants:saturation = 5",
+    "Print:quiet = on"};
+
+  // The two setups: LHC minimum bias and p-Pb.
+  vector<string> names = {"LHC minimum bias", "p-Pb at 5.02 TeV"};
+  vector< vector<string> > setups = {
+    {"Beams:eCM = 13600.", "SoftQCD:nonDiffractive = on"},
+    {"Beams:idA = 2212", "Beams:idB = 1000822080", "Beams:eA = 4000",
+     "Beams:eB = 1570", "Beams:frameType = 2", "HeavyIon:SigFitNGen = 0",
+     "HeavyIon:SigFitDefPar = 2.15,17.24,0.33", "Check:event = off"} };
+
+  for (int iSetup = 0; iSetup < int(setups.size()); ++iSetup) {
+
+    // Generate parton-level events without colour reconnection.
+    Pythia pythiaGen("../share/Pythia8/xmldoc", false);
+    for (const string& line : crSetup) pythiaGen.readString(line);
+    for (const string& line : setups[iSetup]) pythiaGen.readString(line);
+    pythiaGen.readString("ColourReconnection:reconnect = off");
+    pythiaGen.readString("HadronLevel:all = off");
+    if (!pythiaGen.init()) return 1;
+    vector<Event> events;
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent)
+      if (pythiaGen.next()) events.push_back(pythiaGen.event);
+
+    // Reconnect them without and with the rapidity search.
+    cout << "\n " << names[iSetup] << ", " << events.size() << " events:";
+    vector< vector<int> > colsOff(events.size());
+    for (int iSearch = 0; iSearch < 2; ++iSearch) {
+      Pythia pythia("../share/Pythia8/xmldoc", false);
+      for (const string& line : crSetup) pythia.readString(line);
+      for (const string& line : setups[iSetup]) pythia.readString(line);
+      pythia.readString("ProcessLevel:all = off");
+      pythia.readString("HadronLevel:Hadronize = off");
+      pythia.readString("HadronLevel:Decay = off");
+      pythia.readString("ColourReconnection:forceHadronLevelCR = on");
+      pythia.readString(string("ColourReconnection:searchByRapidity = ")
+        + (iSearch == 1 ? "on" : "off"));
+      if (!pythia.init()) return 1;
+      long nPairs = 0;
+      long nJunCombs = 0;
+      int  nDiffer = 0;
+      double seconds = 0.;
+      for (int iEvent = 0; iEvent < int(events.size()); ++iEvent) {
+        // Copied events point to the particle data of pythiaGen; redirect.
+        pythia.event = events[iEvent];
+        pythia.event.init("(complete event)", &pythia.particleData);
+        pythia.event.restorePtrs();
+        Clock::time_point t0 = Clock::now();
+        if (!pythia.forceHadronLevel(false)) continue;
+        seconds += std::chrono::duration<double>(Clock::now() - t0).count();
+        nPairs    += pythia.info.getCounter(32);
+        nJunCombs += pythia.info.getCounter(33);
+
+        // Compare colours of final partons with the first instance.
+        vector<int> cols;
+        for (int i = 0; i < pythia.event.size(); ++i)
+        if (pythia.event[i].isFinal()) {
+          cols.push_back(pythia.event[i].col());
+          cols.push_back(pythia.event[i].acol());
+        }
+        if (iSearch == 0) colsOff[iEvent] = cols;
+        else if (cols != colsOff[iEvent]) ++nDiffer;
+      }
+      cout << fixed << setprecision(2) << "\n   searchByRapidity = "
+           << (iSearch == 1 ? "on " : "off") << ": " << setw(8)
+           << 1000. * seconds / events.size() << " ms per event, "
+           << setprecision(0) << setw(9) << double(nPairs) / events.size()
+           << " pairs and " << setw(10) << double(nJunCombs) / events.size()
+           << " junction combinations tried per event";
+      if (iSearch == 1) cout << ", " << nDiffer << " events differ";
+    }
+    cout << endl;
+  }
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,69 @@
+// main511.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: SUSY; performance
+
+// Benchmark of the hard-process selection for many processes. A scan is
+// made over increasingly large sets of SUSY processes for the SPS1a point,
+// up to SUSY:all. Only the process level is generated, without resonance
+// decays, so that the time per trial is dominated by the selection of a
+// process and the evaluation of its cross section. The number of process
+// containers, trials and the time per trial are shown.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events for each set of processes.
+  int nEvent = 20000;
+  typedef std::chrono::steady_clock Clock;
+
+  // Sets of SUSY processes.
+  vector<string> setNames = {"chi0chi0", "gauginos", "gauginos + squarks",
+    "SUSY:all"};
+  vector< vector<string> > processSets = {
+    {"SUSY:qqbar2chi0chi0 = on"},
+    {"SUSY:qqbar2chi0chi0 = on", "SUSY:qqbar2chi+-chi0 = on",
+     "SUSY:qqbar2chi+chi- = on"},
+    {"SUSY:qqbar2chi0chi0 = on", "SUSY:qqbar2chi+-chi0 = on",
+     "SUSY:qqbar2chi+chi- = on", "SUSY:gg2squarkantisquark = on",
+     "SUSY:qqbar2squarkantisquark = on", "SUSY:qq2squarksquark = on"},
+    {"SUSY:all = on"} };
+
+  // Loop over the sets.
+  cout << "\n SPS1a at 13 TeV, " << nEvent << " events per set:";
+  for (int iSet = 0; iSet < int(processSets.size()); ++iSet) {
+    Pythia pythia("../share/Pythia8/xmldoc", false);
+    for (const char* line : {"Beams:eCM = 13000.",
+      "SLHA:file = sps1aWithDecays.spc", "SLHA:verbose = 0",
+      "ProcessLevel:resonanceDecays = off",
+      "PartonLevel:all = off", "HadronLevel:all = off", "Print:quiet = on"})
+      pythia.readString(line);
+    for (const string& line : processSets[iSet]) pythia.readString(line);
+    if (!pythia.init()) return 1;
+
+    // Event loop.
+    Clock::time_point t0 = Clock::now();
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) pythia.next();
+    double seconds = std::chrono::duration<double>(Clock::now() - t0)
+      .count();
+    long nTried = pythia.info.nTried();
+    cout << "\n   " << left << setw(20) << setNames[iSet] << right << ": "
+         << setw(4) << pythia.info.codesHard().size() << " processes, "
+         << setw(8) << nTried << " trials, " << fixed << setprecision(3)
+         << setw(6) << seconds << " s, " << setprecision(2) << setw(6)
+         << 1e6 * seconds / nTried << " us per trial, sigma "
+         << scientific << setprecision(3) << pythia.info.sigmaGen() << " mb"
+         << std::defaultfloat;
+  }
+  cout << endl;
+
+  // Done.
+  return 0;
+}
@@ -35,8 +35,9 @@ public:
     if (abs(power - 2.) < 0.01) powerInt = 2;
     powerMod = 0.5 * power - 1.;}
 
-  // Analyze event.
+  // Analyze event, either directly or in columnar form.
   bool analyze(const Event& event);
+  bool analyze(const EventColumns& cols);
 
   // Return info on results of analysis.
   double sphericity()      const {return 1.5 * (eVal2 + eVal3);}
@@ -70,6 +71,9 @@ private:
   // Error statistics;
   int    nFew;
 
+  // Find eigenvalues and eigenvectors of the summed momentum tensor.
+  bool diagonalize(double tt[4][4], double denom, int nStudy);
+
 };
 
 //==========================================================================
@@ -85,8 +89,9 @@ public:
   Thrust(int selectIn = 2) : select(selectIn), eVal1(), eVal2(), eVal3(),
     nFew(0) {}
 
-  // Analyze event.
+  // Analyze event, either directly or in columnar form.
   bool analyze(const Event& event);
+  bool analyze(const EventColumns& cols);
 
   // Return info on results of analysis.
   double thrust()       const {return eVal1;}
@@ -118,6 +123,9 @@ private:
   // Error statistics;
   int    nFew;
 
+  // Find thrust and major axes from the selected momenta.
+  bool findAxes(vector<Vec4>& pOrder, const Vec4& pSum);
+
 };
 
 //==========================================================================
@@ -447,8 +455,16 @@ public:
     while (clSize > 0) doStep();
     return true; }
 
+  // Analyze event in columnar form, all in one go. Not with SlowJetHook.
+  bool analyze(const EventColumns& cols) {
+    if ( !setup(cols) ) return false;
+    if (useFJcore) return clusterFJ();
+    while (clSize > 0) doStep();
+    return true; }
+
   // Set up list of particles to analyze, and initial distances.
   bool setup(const Event& event);
+  bool setup(const EventColumns& cols);
 
   // Do one recombination step, possibly giving a jet.
   virtual bool doStep();
@@ -550,6 +566,10 @@ protected:
   // Use FJcore interface to perform clustering.
   bool clusterFJ();
 
+  // Store a particle as a new cluster, and set up initial distances.
+  void addCluster(const Vec4& pTemp, double mTemp, int i);
+  bool setupDistances();
+
 };
 
 //==========================================================================
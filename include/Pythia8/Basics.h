@@ -36,9 +36,8 @@ public:
   // Constructors.
   Vec4(double xIn = 0., double yIn = 0., double zIn = 0., double tIn = 0.)
     : xx(xIn), yy(yIn), zz(zIn), tt(tIn) { }
-  Vec4(const Vec4& v) : xx(v.xx), yy(v.yy), zz(v.zz), tt(v.tt) { }
-  Vec4& operator=(const Vec4& v) { if (this != &v) { xx = v.xx; yy = v.yy;
-    zz = v.zz; tt = v.tt; } return *this; }
+  Vec4(const Vec4& v) = default;
+  Vec4& operator=(const Vec4& v) = default;
   Vec4& operator=(double value) { xx = value; yy = value; zz = value;
     tt = value; return *this; }
 
@@ -388,9 +387,10 @@ class Rndm {
 public:
 
   // Constructors.
-  Rndm() : initRndm(false), stateSave(), useExternalRndm(false) { }
-  Rndm(int seedIn) : initRndm(false), stateSave(), useExternalRndm(false) {
-    init(seedIn);}
+  Rndm() : initRndm(false), stateSave(), useExternalRndm(false),
+    iBuffer(0), nBuffer(0) { }
+  Rndm(int seedIn) : initRndm(false), stateSave(), useExternalRndm(false),
+    iBuffer(0), nBuffer(0) { init(seedIn);}
 
   // Possibility to pass in pointer for external random number generation.
   bool rndmEnginePtr( RndmEnginePtr rndmEngPtrIn);
@@ -398,8 +398,21 @@ public:
   // Initialize, normally at construction or in first call.
   void init(int seedIn = 0) ;
 
+  // Initialize quickly from a 64-bit seed, for many short independent
+  // sub-streams. Does not give the same sequence as init(seedIn).
+  void initSubStream(uint64_t seedIn);
+
   // Generate next random number uniformly between 0 and 1.
-  double flat() ;
+  // Numbers are generated in batches, and then handed out one by one.
+  double flat() {
+    return (iBuffer < nBuffer) ? buffer[iBuffer++] : flatFill();}
+
+  // Fill an array with n random numbers, uniformly between 0 and 1,
+  // according to exp(-x), or according to exp(-x^2/2). The numbers and
+  // the final state are the same as for n calls to flat, exp or gauss.
+  void flatBatch(double* out, int n);
+  void expBatch(double* out, int n);
+  void gaussBatch(double* out, int n);
 
   // Generate random numbers according to exp(-x).
   double exp() ;
@@ -408,7 +421,9 @@ public:
   double xexp() { return -log(flat() * flat()) ;}
 
   // Generate random numbers according to exp(-x^2/2).
-  double gauss() {return sqrt(-2. * log(flat())) * cos(M_PI * flat());}
+  // The first number gives the radius and the second the angle.
+  double gauss() {double r = sqrt(-2. * log(flat()));
+    return r * cos(M_PI * flat());}
 
   // Generate two random numbers according to exp(-x^2/2-y^2/2).
   pair<double, double> gauss2() {double r = sqrt(-2. * log(flat()));
@@ -432,8 +447,9 @@ public:
   bool readState(string fileName);
 
   // Get or set the state of the random number generator.
-  RndmState getState() const {return stateSave;}
-  void setState(const RndmState& state) {stateSave = state;}
+  RndmState getState() const;
+  void setState(const RndmState& state) {stateSave = state;
+    initRndm = true; iBuffer = nBuffer = 0;}
 
   // The default seed, i.e. the Marsaglia-Zaman random number sequence.
   static constexpr int DEFAULTSEED = 19780503;
@@ -464,6 +480,56 @@ private:
   bool   useExternalRndm;
   RndmEnginePtr rndmEngPtr{};
 
+  // Constants: could only be changed in the code itself.
+  // Size of buffer, and longest segment of independent numbers.
+  static constexpr int NBUFFER = 64, NSEGMENT = 33;
+
+  // Buffer of generated numbers not yet handed out, and the state
+  // before the buffer was filled, from which the exact state can be found.
+  double    buffer[NBUFFER];
+  int       iBuffer, nBuffer;
+  RndmState stateBuffer;
+
+  // Refill the buffer and return its first number.
+  double flatFill();
+
+  // Generate n numbers into an array, updating the state.
+  void generate(double* out, int n);
+
+  // Step a state one number forward, the standard way.
+  static double flatStep(RndmState& state);
+
+  // Undo the generation of numbers in the buffer not yet handed out.
+  void dropBuffer() {if (iBuffer < nBuffer) stateSave = getState();
+    iBuffer = nBuffer = 0;}
+
+};
+
+//==========================================================================
+
+// The RndmStateGuard class saves the state of a random number generator,
+// and restores it when going out of scope, also at an early return.
+// Does nothing if given a null pointer.
+
+class RndmStateGuard {
+
+public:
+
+  // Constructor saves the state, destructor restores it.
+  RndmStateGuard(Rndm* rndmPtrIn) : rndmPtr(rndmPtrIn), stateSave() {
+    if (rndmPtr != nullptr) stateSave = rndmPtr->getState();}
+  ~RndmStateGuard() {if (rndmPtr != nullptr) rndmPtr->setState(stateSave);}
+
+  // Not to be copied.
+  RndmStateGuard(const RndmStateGuard&) = delete;
+  RndmStateGuard& operator=(const RndmStateGuard&) = delete;
+
+private:
+
+  // The generator and its saved state.
+  Rndm*     rndmPtr;
+  RndmState stateSave;
+
 };
 
 //==========================================================================
@@ -522,6 +588,13 @@ public:
   // Fill bin with weight.
   void fill(double x, double w = 1.) ;
 
+  // Fill many values in one call, with common or individual weights.
+  void fill(const vector<double>& x, double w = 1.) {
+    for (int i = 0; i < int(x.size()); ++i) fill( x[i], w);}
+  void fill(const vector<double>& x, const vector<double>& w) {
+    int n = min( x.size(), w.size());
+    for (int i = 0; i < n; ++i) fill( x[i], w[i]);}
+
   // Print a histogram with overloaded << operator.
   friend ostream& operator<<(ostream& os, const Hist& h) ;
 
@@ -733,6 +806,86 @@ Hist operator/(double f, const Hist& h1);
 
 //==========================================================================
 
+// ParallelHist class.
+// A histogram that can be filled from several threads at the same time,
+// e.g. in the callback of PythiaParallel::run with processAsync on.
+// Each thread fills its own copy, a shard, which is created the first
+// time the thread fills. Filling therefore needs no locks. The shards
+// are summed when the result is requested.
+
+class ParallelHist {
+
+public:
+
+  // Constructor, with the same arguments as for Hist.
+  ParallelHist(string titleIn, int nBinIn = 100, double xMinIn = 0.,
+    double xMaxIn = 1., bool logXIn = false, bool doStatsIn = false) :
+    baseHist(titleIn, nBinIn, xMinIn, xMaxIn, logXIn, doStatsIn),
+    shards(NSHARDMAX) {for (int i = 0; i < NSHARDMAX; ++i)
+    shards[i].store(nullptr);}
+
+  // Destructor.
+  ~ParallelHist() {
+    for (int i = 0; i < NSHARDMAX; ++i) delete shards[i].load();}
+
+  // Shards cannot be copied; use result() for a copy of the contents.
+  ParallelHist(const ParallelHist&) = delete;
+  ParallelHist& operator=(const ParallelHist&) = delete;
+
+  // Fill with weight, one or many values. Thread-safe.
+  void fill(double x, double w = 1.) {
+    Hist* hPtr = shard();
+    if (hPtr != nullptr) hPtr->fill(x, w);
+    else { lock_guard<mutex> lock(baseMutex); baseHist.fill(x, w);} }
+  void fill(const vector<double>& x, double w = 1.) {
+    Hist* hPtr = shard();
+    if (hPtr != nullptr) hPtr->fill(x, w);
+    else { lock_guard<mutex> lock(baseMutex); baseHist.fill(x, w);} }
+  void fill(const vector<double>& x, const vector<double>& w) {
+    Hist* hPtr = shard();
+    if (hPtr != nullptr) hPtr->fill(x, w);
+    else { lock_guard<mutex> lock(baseMutex); baseHist.fill(x, w);} }
+
+  // Add the contents of another histogram. Thread-safe.
+  ParallelHist& operator+=(const Hist& h) {
+    lock_guard<mutex> lock(baseMutex); baseHist += h; return *this;}
+  ParallelHist& operator+=(const ParallelHist& h) {
+    Hist hSum = h.result(); return *this += hSum;}
+
+  // Sum of all shards, as an ordinary histogram. Should not be called
+  // while other threads are filling.
+  Hist result() const;
+
+  // Reset contents. Should not be called while other threads are filling.
+  void null();
+
+  // Title of the histogram.
+  string getTitle() const {return baseHist.getTitle();}
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  // Maximum number of threads filling without locks at the same time.
+  static const int NSHARDMAX;
+
+  // Contributions not in a shard, and a lock for it. Also used to
+  // book the shards.
+  Hist  baseHist;
+  mutable mutex baseMutex;
+
+  // One shard for each thread index, created on first use.
+  vector< atomic<Hist*> > shards;
+
+  // The shard of the current thread, or nullptr if too many threads.
+  Hist* shard();
+
+  // Small index of the current thread, reused after a thread ends.
+  static int threadIndex();
+
+};
+
+//==========================================================================
+
 // HistPlot class.
 // Writes a Python program that can generate PDF plots from Hist histograms.
 
@@ -51,7 +51,8 @@ public:
 
   // Constructor.
   BoseEinstein() : doPion(), doKaon(), doEta(), lambda(), QRef(),
-    nStep(), nStep3(), nStored(), QRef2(), QRef3(), R2Ref(), R2Ref2(),
+    QMaxPair(), Q2MaxPair(), nStep(), nStep3(), nStored(), QRef2(),
+    QRef3(), R2Ref(), R2Ref2(),
     R2Ref3(), mHadron(), mPair(), m2Pair(), deltaQ(), deltaQ3(), maxQ(),
     maxQ3(), shift(), shift3() {}
 
@@ -65,11 +66,11 @@ private:
 
   // Constants: could only be changed in the code itself.
   static const int    IDHADRON[9], ITABLE[9], NCOMPSTEP;
-  static const double STEPSIZE, Q2MIN, COMPRELERR, COMPFACMAX;
+  static const double STEPSIZE, Q2MIN, COMPRELERR, COMPFACMAX, YMARGIN;
 
   // Initialization data, read from Settings.
   bool   doPion, doKaon, doEta;
-  double lambda, QRef;
+  double lambda, QRef, QMaxPair, Q2MaxPair;
 
   // Table of momentum shifts for different hadron species.
   int    nStep[4], nStep3[4], nStored[10];
@@ -80,6 +81,9 @@ private:
   // Vector of hadrons to study.
   vector<BoseEinsteinHadron> hadronBE;
 
+  // Rapidity and index of the hadrons of one species, for pair search.
+  vector< pair<double, int> > yOrder;
+
   // Calculate shift and (unnormalized) compensation for pair.
   void shiftPair(int i1, int i2, int iHad);
 
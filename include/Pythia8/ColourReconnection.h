@@ -62,6 +62,16 @@ public:
   int ciCol{-1}, ciAcol{-1};
   bool pCalculated{false};
 
+  // Information for caching dipole rapidity, and the maximal rapidity
+  // difference to dipoles it can be causally connected with (negative
+  // if no such limit is known).
+  double yDip{0.}, dyMaxDip{-1.};
+  int yiCol{-1}, yiAcol{-1};
+  bool yCalculated{false};
+
+  // Last update of the trial reconnections in which the dipole was used.
+  int iUsed{0};
+
   // Printing function, mainly intended for debugging.
   void list() const;
   long index{0};
@@ -131,6 +141,11 @@ public:
   int mode;
   double lambdaDiff;
 
+  // Update of the trial reconnections in which the trial was formed,
+  // and order in which it was formed, used for equal lambdaDiff.
+  int iUpdate{0};
+  long iOrder{0};
+
 };
 
 //==========================================================================
@@ -175,7 +190,8 @@ public:
     timeDilationMode(), eCM(), sCM(), pT0(), pT20Rec(), pT0Ref(), ecmRef(),
     ecmPow(), reconnectRange(), m0(), mPseudo(), m2Lambda(), fracGluon(),
     dLambdaCut(), timeDilationPar(), timeDilationParGeV(), tfrag(), blowR(),
-    blowT(), rHadron(), kI(), dipMaxDist(), nColMove() {}
+    blowT(), rHadron(), kI(), dipMaxDist(), searchByRapidity(), iUpdate(),
+    nTrials(), nColMove() {}
 
   // Initialization.
   bool init();
@@ -190,7 +206,8 @@ public:
 private:
 
   // Constants: could only be changed in the code itself.
-  static const double MINIMUMGAIN, MINIMUMGAINJUN, TINYP1P2;
+  static const double MINIMUMGAIN, MINIMUMGAINJUN, TINYP1P2, TINYM2DIP,
+                      DYMARGIN;
   static const int MAXRECONNECTIONS;
 
   // Variables needed.
@@ -202,6 +219,7 @@ private:
          m0, mPseudo, m2Lambda, fracGluon, dLambdaCut, timeDilationPar,
          timeDilationParGeV, tfrag, blowR, blowT, rHadron, kI;
   double dipMaxDist;
+  bool   searchByRapidity;
 
   // List of current dipoles.
   vector<ColourDipolePtr> dipoles, usedDipoles;
@@ -224,10 +242,19 @@ private:
     dipoles.back()->index = ++dipoleIndex;
   }
 
-  // Lists of particles, junctions and trials.
+  // Lists of particles, junctions and trials. The trials are kept as heaps,
+  // with the largest lambdaDiff first.
   vector<ColourJunction> junctions;
   vector<ColourParticle> particles;
   vector<TrialReconnection> junTrials, dipTrials;
+  int  iUpdate;
+  long nTrials;
+
+  // Active dipoles of each reconnection colour, (rapidity, position in
+  // dipoles) ordered in rapidity, and those without a rapidity limit.
+  vector< vector< pair<double,int> > > yOrderDips;
+  vector< vector<int> > iUnorderedDips;
+  vector<double> dyMaxDips;
   vector<vector<int> > iColJun;
   vector<double> formationTimes;
 
@@ -369,6 +396,34 @@ private:
   // Update the list of dipole trial swaps to account for latest swap.
   void updateJunctionTrials();
 
+  // Add a trial reconnection to a heap of trials.
+  void addTrial(vector<TrialReconnection>& trials,
+    TrialReconnection& trial);
+
+  // Mark the used dipoles, so that trials containing them are dropped.
+  void markUsedDips();
+
+  // Remove the trials containing used dipoles from the top of a heap.
+  void removeUsedTrials(vector<TrialReconnection>& trials);
+
+  // Find the rapidity of a dipole and its maximal rapidity difference
+  // to dipoles it can be causally connected with.
+  void setDipoleRapidity(const ColourDipolePtr& dip) const;
+
+  // Check whether two (of three) dipoles can be causally connected,
+  // given their rapidities.
+  bool nearInRapidity(const ColourDipolePtr& dip1,
+    const ColourDipolePtr& dip2, bool forTriple = false) const;
+
+  // Order the active dipoles of each reconnection colour in rapidity,
+  // for dipole swaps or for junction formation.
+  void orderDipoles(bool forJunctions);
+
+  // Find the dipoles of a reconnection colour that can be causally
+  // connected with a given dipole, as increasing positions in dipoles.
+  void findNeighbours(const ColourDipolePtr& dip, int iGroup, int iAfter,
+    bool forTriple, vector<int>& iNeighbours);
+
   // Check whether up to four dipoles are 'causally' connected.
   bool checkTimeDilation(const ColourDipolePtr& dip1 = 0,
     const ColourDipolePtr& dip2 = 0, const ColourDipolePtr& dip3 = 0,
@@ -394,6 +394,11 @@ public:
   virtual map<string, double> getStateVariables (const Event& state,
     int rad, int emt, int rec, string name);
 
+  // Return the same variables in a fixed layout, without string lookups.
+  // Only the starting scales of individual dipoles are stored by name.
+  virtual StateVariables stateVariables(const Event& state, int rad,
+    int emt, int rec, const string& name);
+
   // From Pythia version 8.215 onwards.
   // Check if attempted clustering is handled by timelike shower
   // Usage: isTimelike( const Event& event,  int iRad, int iEmt,
@@ -59,15 +59,8 @@ public:
     pSave(pIn), mSave(mIn), scaleSave(scaleIn), polSave(polIn),
     hasVertexSave(false), vProdSave(Vec4(0.,0.,0.,0.)), tauSave(0.),
     pdePtr(0), evtPtr(0) { }
-  Particle(const Particle& pt) : idSave(pt.idSave),
-    statusSave(pt.statusSave), mother1Save(pt.mother1Save),
-    mother2Save(pt.mother2Save), daughter1Save(pt.daughter1Save),
-    daughter2Save(pt.daughter2Save), colSave(pt.colSave),
-    acolSave(pt.acolSave), pSave(pt.pSave), mSave(pt.mSave),
-    scaleSave(pt.scaleSave), polSave(pt.polSave),
-    hasVertexSave(pt.hasVertexSave), vProdSave(pt.vProdSave),
-    tauSave(pt.tauSave), pdePtr(pt.pdePtr), evtPtr(pt.evtPtr) { }
-  Particle& operator=(const Particle& pt) {if (this != &pt) {
+  Particle(const Particle& pt) = default;
+  Particle& operator=(const Particle& pt) {if (this != &pt) {logChange();
     idSave = pt.idSave; statusSave = pt.statusSave;
     mother1Save = pt.mother1Save; mother2Save = pt.mother2Save;
     daughter1Save = pt.daughter1Save; daughter2Save = pt.daughter2Save;
@@ -82,46 +75,55 @@ public:
 
   // Member functions to set the Event and ParticleDataEntry pointers.
   void setEvtPtr(Event* evtPtrIn) { evtPtr = evtPtrIn; setPDEPtr();}
-  void setPDEPtr(ParticleDataEntryPtr pdePtrIn = nullptr);
+  void setPDEPtr(ParticleDataEntry* pdePtrIn = nullptr);
 
   // Member functions for input.
-  void id(int idIn) {idSave = idIn; setPDEPtr();}
-  void status(int statusIn) {statusSave = statusIn;}
-  void statusPos() {statusSave = abs(statusSave);}
-  void statusNeg() {statusSave = -abs(statusSave);}
-  void statusCode(int statusIn) {statusSave =
+  void id(int idIn) {logChange(); idSave = idIn; setPDEPtr();}
+  void status(int statusIn) {logChange(); statusSave = statusIn;}
+  void statusPos() {logChange(); statusSave = abs(statusSave);}
+  void statusNeg() {logChange(); statusSave = -abs(statusSave);}
+  void statusCode(int statusIn) {logChange(); statusSave =
     (statusSave > 0) ? abs(statusIn) : -abs(statusIn);}
-  void mother1(int mother1In) {mother1Save = mother1In;}
-  void mother2(int mother2In) {mother2Save = mother2In;}
+  void mother1(int mother1In) {logChange(); mother1Save = mother1In;}
+  void mother2(int mother2In) {logChange(); mother2Save = mother2In;}
   void mothers(int mother1In = 0, int mother2In = 0)
-    {mother1Save = mother1In; mother2Save = mother2In;}
-  void daughter1(int daughter1In) {daughter1Save = daughter1In;}
-  void daughter2(int daughter2In) {daughter2Save = daughter2In;}
-  void daughters(int daughter1In = 0, int daughter2In = 0)
-    {daughter1Save = daughter1In; daughter2Save = daughter2In;}
-  void col(int colIn) {colSave = colIn;}
-  void acol(int acolIn) {acolSave = acolIn;}
-  void cols(int colIn = 0,int acolIn = 0) {colSave = colIn;
+    {logChange(); mother1Save = mother1In; mother2Save = mother2In;}
+  void daughter1(int daughter1In) {logChange();
+    daughter1Save = daughter1In;}
+  void daughter2(int daughter2In) {logChange();
+    daughter2Save = daughter2In;}
+  void daughters(int daughter1In = 0, int daughter2In = 0) {logChange();
+    daughter1Save = daughter1In; daughter2Save = daughter2In;}
+  void col(int colIn) {logChange(); colSave = colIn;}
+  void acol(int acolIn) {logChange(); acolSave = acolIn;}
+  void cols(int colIn = 0,int acolIn = 0) {logChange(); colSave = colIn;
     acolSave = acolIn;}
-  void p(Vec4 pIn) {pSave = pIn;}
+  void p(Vec4 pIn) {logChange(); pSave = pIn;}
   void p(double pxIn, double pyIn, double pzIn, double eIn)
-    {pSave.p(pxIn, pyIn, pzIn, eIn);}
-  void px(double pxIn) {pSave.px(pxIn);}
-  void py(double pyIn) {pSave.py(pyIn);}
-  void pz(double pzIn) {pSave.pz(pzIn);}
-  void e(double eIn) {pSave.e(eIn);}
-  void m(double mIn) {mSave = mIn;}
-  void scale(double scaleIn) {scaleSave = scaleIn;}
-  void pol(double polIn) {polSave = polIn;}
-  void vProd(Vec4 vProdIn) {vProdSave = vProdIn; hasVertexSave = true;}
+    {logChange(); pSave.p(pxIn, pyIn, pzIn, eIn);}
+  void px(double pxIn) {logChange(); pSave.px(pxIn);}
+  void py(double pyIn) {logChange(); pSave.py(pyIn);}
+  void pz(double pzIn) {logChange(); pSave.pz(pzIn);}
+  void e(double eIn) {logChange(); pSave.e(eIn);}
+  void m(double mIn) {logChange(); mSave = mIn;}
+  void scale(double scaleIn) {logChange(); scaleSave = scaleIn;}
+  void pol(double polIn) {logChange(); polSave = polIn;}
+  void vProd(Vec4 vProdIn) {logChange(); vProdSave = vProdIn;
+    hasVertexSave = true;}
   void vProd(double xProdIn, double yProdIn, double zProdIn, double tProdIn)
-    {vProdSave.p(xProdIn, yProdIn, zProdIn, tProdIn); hasVertexSave = true;}
-  void xProd(double xProdIn) {vProdSave.px(xProdIn); hasVertexSave = true;}
-  void yProd(double yProdIn) {vProdSave.py(yProdIn); hasVertexSave = true;}
-  void zProd(double zProdIn) {vProdSave.pz(zProdIn); hasVertexSave = true;}
-  void tProd(double tProdIn) {vProdSave.e(tProdIn); hasVertexSave = true;}
-  void vProdAdd(Vec4 vProdIn) {vProdSave += vProdIn; hasVertexSave = true;}
-  void tau(double tauIn) {tauSave = tauIn;}
+    {logChange(); vProdSave.p(xProdIn, yProdIn, zProdIn, tProdIn);
+    hasVertexSave = true;}
+  void xProd(double xProdIn) {logChange(); vProdSave.px(xProdIn);
+    hasVertexSave = true;}
+  void yProd(double yProdIn) {logChange(); vProdSave.py(yProdIn);
+    hasVertexSave = true;}
+  void zProd(double zProdIn) {logChange(); vProdSave.pz(zProdIn);
+    hasVertexSave = true;}
+  void tProd(double tProdIn) {logChange(); vProdSave.e(tProdIn);
+    hasVertexSave = true;}
+  void vProdAdd(Vec4 vProdIn) {logChange(); vProdSave += vProdIn;
+    hasVertexSave = true;}
+  void tau(double tauIn) {logChange(); tauSave = tauIn;}
 
   // Member functions for output.
   int    id()        const {return idSave;}
@@ -271,26 +273,30 @@ public:
   ParticleDataEntry& particleDataEntry() const {return *pdePtr;}
 
   // Member functions that perform operations.
-  void rescale3(double fac) {pSave.rescale3(fac);}
-  void rescale4(double fac) {pSave.rescale4(fac);}
-  void rescale5(double fac) {pSave.rescale4(fac); mSave *= fac;}
-  void rot(double thetaIn, double phiIn) {pSave.rot(thetaIn, phiIn);
+  void rescale3(double fac) {logChange(); pSave.rescale3(fac);}
+  void rescale4(double fac) {logChange(); pSave.rescale4(fac);}
+  void rescale5(double fac) {logChange(); pSave.rescale4(fac); mSave *= fac;}
+  void rot(double thetaIn, double phiIn) {logChange();
+    pSave.rot(thetaIn, phiIn);
     if (hasVertexSave) vProdSave.rot(thetaIn, phiIn);}
-  void bst(double betaX, double betaY, double betaZ) {
+  void bst(double betaX, double betaY, double betaZ) {logChange();
     pSave.bst(betaX, betaY, betaZ);
     if (hasVertexSave) vProdSave.bst(betaX, betaY, betaZ);}
   void bst(double betaX, double betaY, double betaZ, double gamma) {
+    logChange();
     pSave.bst(betaX, betaY, betaZ, gamma);
     if (hasVertexSave) vProdSave.bst(betaX, betaY, betaZ, gamma);}
-  void bst(const Vec4& pBst) {pSave.bst(pBst);
+  void bst(const Vec4& pBst) {logChange(); pSave.bst(pBst);
     if (hasVertexSave) vProdSave.bst(pBst);}
-  void bst(const Vec4& pBst, double mBst) {pSave.bst(pBst, mBst);
+  void bst(const Vec4& pBst, double mBst) {logChange(); pSave.bst(pBst, mBst);
     if (hasVertexSave) vProdSave.bst(pBst, mBst);}
-  void bstback(const Vec4& pBst) {pSave.bstback(pBst);
+  void bstback(const Vec4& pBst) {logChange(); pSave.bstback(pBst);
     if (hasVertexSave) vProdSave.bstback(pBst);}
-  void bstback(const Vec4& pBst, double mBst) {pSave.bstback(pBst, mBst);
+  void bstback(const Vec4& pBst, double mBst) {logChange();
+    pSave.bstback(pBst, mBst);
     if (hasVertexSave) vProdSave.bstback(pBst, mBst);}
-  void rotbst(const RotBstMatrix& M, bool boostVertex = true) {pSave.rotbst(M);
+  void rotbst(const RotBstMatrix& M, bool boostVertex = true) {logChange();
+    pSave.rotbst(M);
     if (hasVertexSave && boostVertex) vProdSave.rotbst(M);}
   void offsetHistory( int minMother, int addMother, int minDaughter,
     int addDaughter);
@@ -314,12 +320,19 @@ protected:
   // Should no be saved in a persistent copy of the event record.
   // The //! below is ROOT notation that this member should not be saved.
   // Event::restorePtrs() can be called to restore the missing information.
-  ParticleDataEntryPtr pdePtr;  //!
+  // The pointer is non-owning, so that copying a particle does not update
+  // any reference count. The entry is kept alive by the ParticleData
+  // object it was taken from, also if it is later replaced there.
+  ParticleDataEntry* pdePtr;  //!
 
   // Pointer to the whole event record to which the particle belongs (if any).
   // As above it should not be saved.
   Event*             evtPtr;  //!
 
+  // Log the particle in the event record undo log before it is changed,
+  // if a checkpoint is active. Defined after the Event class.
+  void logChange();
+
 };
 
 // Particles invariant mass, mass squared, and momentum dot product.
@@ -470,12 +483,12 @@ public:
      particleDataPtr = particleDataPtrIn; startColTag = startColTagIn;}
 
   // Clear event record.
-  void clear() {entry.resize(0); maxColTag = startColTag;
-    savedPartonLevelSize = 0; scaleSave = 0.; scaleSecondSave = 0.;
-    clearJunctions(); clearHV(); clearStringBreaks();}
-  void free() {vector<Particle>().swap(entry); maxColTag = startColTag;
+  void clear() {touchAll(); entry.resize(0); maxColTag = startColTag;
     savedPartonLevelSize = 0; scaleSave = 0.; scaleSecondSave = 0.;
     clearJunctions(); clearHV(); clearStringBreaks();}
+  void free() {touchAll(); vector<Particle>().swap(entry);
+    maxColTag = startColTag; savedPartonLevelSize = 0; scaleSave = 0.;
+    scaleSecondSave = 0.; clearJunctions(); clearHV(); clearStringBreaks();}
 
   // Clear event record, and set first particle empty.
   void reset() {clear(); append(90, -11, 0, 0, 0., 0., 0., 0., 0.);}
@@ -558,7 +571,8 @@ public:
     bool showMothersAndDaughters = false, int precision = 3) const;
 
   // Remove last n entries.
-  void popBack(int nRemove = 1) { if (nRemove ==1) entry.pop_back();
+  void popBack(int nRemove = 1) { touchFrom( size() - nRemove);
+    if (nRemove ==1) entry.pop_back();
     else {int newSize = max( 0, size() - nRemove);
     entry.resize(newSize);} }
 
@@ -572,9 +586,20 @@ public:
 
   // Save or restore the size of the event record (throwing at the end).
   void saveSize() {savedSize = entry.size();}
-  void restoreSize() {entry.resize(savedSize);}
+  void restoreSize() {touchFrom(savedSize); entry.resize(savedSize);}
   int  savedSizeValue() {return savedSize;}
 
+  // Save a checkpoint of the event record, restore the record to the
+  // latest checkpoint, or drop the latest checkpoint but keep the changes.
+  // Instead of a full copy, entries are saved in an undo log the first
+  // time they are changed after the checkpoint, by Particle set methods,
+  // assignment or Event methods, so a failed attempt only costs as much
+  // as the entries it changed. Checkpoints can be nested.
+  void saveCheckpoint();
+  void restoreCheckpoint();
+  void clearCheckpoint();
+  int  sizeCheckpoint() const {return nCheckpoint;}
+
   // Initialize and access colour tag information.
   void initColTag(int colTag = 0) {maxColTag = max( colTag,startColTag);}
   int lastColTag() const {return maxColTag;}
@@ -615,17 +640,17 @@ public:
     return sqrt( pow2(detaAbs(i1, i2)) + pow2(dphiAbs(i1, i2)) ); }
 
   // Member functions for rotations and boosts of an event.
-  void rot(double theta, double phi)
-    {for (int i = 0; i < size(); ++i) entry[i].rot(theta, phi);}
-  void bst(double betaX, double betaY, double betaZ)
-    {for (int i = 0; i < size(); ++i) entry[i].bst(betaX, betaY, betaZ);}
+  void rot(double theta, double phi) {touchAll();
+    for (int i = 0; i < size(); ++i) entry[i].rot(theta, phi);}
+  void bst(double betaX, double betaY, double betaZ) {touchAll();
+    for (int i = 0; i < size(); ++i) entry[i].bst(betaX, betaY, betaZ);}
   void bst(double betaX, double betaY, double betaZ, double gamma)
-    {for (int i = 0; i < size(); ++i) entry[i].bst(betaX, betaY, betaZ,
-    gamma);}
-  void bst(const Vec4& vec)
-    {for (int i = 0; i < size(); ++i) entry[i].bst(vec);}
-  void rotbst(const RotBstMatrix& M, bool boostVertices = true)
-    {for (int i = 0; i < size(); ++i) entry[i].rotbst(M, boostVertices);}
+    {touchAll(); for (int i = 0; i < size(); ++i) entry[i].bst(betaX,
+    betaY, betaZ, gamma);}
+  void bst(const Vec4& vec) {touchAll();
+    for (int i = 0; i < size(); ++i) entry[i].bst(vec);}
+  void rotbst(const RotBstMatrix& M, bool boostVertices = true) {touchAll();
+    for (int i = 0; i < size(); ++i) entry[i].rotbst(M, boostVertices);}
 
   // Clear the list of junctions.
   void clearJunctions() {junction.resize(0);}
@@ -741,6 +766,97 @@ private:
   // The //! below is ROOT notation that this member should not be saved.
   ParticleData* particleDataPtr;  //!
 
+  // A checkpoint stores the sizes and scalar properties of the event, the
+  // (short) lists of junctions and HV colours, and where its part of the
+  // undo log begins.
+  struct Checkpoint {
+    int size, maxColTag, savedSize, savedJunctionSize, savedHVcolsSize,
+        savedPartonLevelSize, iEventHV, iIndexHV, sizeUndoLog;
+    double scaleSave, scaleSecondSave;
+    vector<Pythia8::Junction> junction;
+    vector<Pythia8::HVcols> hvCols;
+    vector<Pythia8::StringBreaks> stringBreaks;
+  };
+
+  // An undo log entry is an entry of the event record as it was before
+  // being accessed, with the checkpoint level it was logged at before.
+  struct UndoEntry {
+    int i, levelOld;
+    Pythia8::Particle entryOld;
+  };
+
+  // Stack of checkpoints, kept allocated for reuse, undo log, and for each
+  // entry the innermost checkpoint level for which it has been logged.
+  vector<Checkpoint> checkpoints;             //!
+  vector<UndoEntry>  undoLog;                 //!
+  vector<int>        undoLevel;               //!
+  int nCheckpoint{0}, sizeCheckpointNow{0};   //!
+
+  // Log an entry before it may be modified, if not already done.
+  void touch(int i) { if (i >= 0 && i < sizeCheckpointNow
+    && undoLevel[i] < nCheckpoint) logEntry(i);}
+  void touchFrom(int iBeg) { if (nCheckpoint > 0) for (int i = max( 0,
+    iBeg); i < sizeCheckpointNow && i < size(); ++i) touch(i);}
+  void touchAll() {touchFrom(0);}
+  void touch(const Particle* ptr) {
+    std::less<const Particle*> before;
+    if (!before(ptr, entry.data()) && before(ptr, entry.data() + size()))
+      touch( int(ptr - entry.data()) );}
+  void logEntry(int i);
+
+};
+
+//--------------------------------------------------------------------------
+
+// Particle method that needs the Event class to be defined.
+
+inline void Particle::logChange() {
+  if (evtPtr != 0 && evtPtr->nCheckpoint > 0) evtPtr->touch(this);}
+
+//==========================================================================
+
+// The EventColumns class holds a columnar copy of the most commonly used
+// particle properties of an event, i.e. one contiguous array for each
+// property rather than one Particle object for each entry. Loops that
+// only need a few properties then touch less memory, and can more easily
+// be vectorized by the compiler. It is a snapshot of the event, and has
+// to be refilled whenever the event is changed.
+
+class EventColumns {
+
+public:
+
+  // Constructors.
+  EventColumns() : nSave(0) {}
+  EventColumns(const Event& event) : nSave(0) {fill(event);}
+
+  // Fill the arrays from an event. The storage is reused between events.
+  void fill(const Event& event);
+
+  // Number of entries, same as in the event.
+  int size() const {return nSave;}
+
+  // Shorthands matching the corresponding Particle methods.
+  bool isFinal(int i)   const {return status[i] > 0;}
+  bool isCharged(int i) const {return chargeType[i] != 0;}
+  bool isNeutral(int i) const {return chargeType[i] == 0;}
+  bool isVisible(int i) const {return visible[i] != 0;}
+  Vec4 p(int i) const {return Vec4( px[i], py[i], pz[i], e[i]);}
+
+  // Four-momentum components and mass.
+  vector<double> px, py, pz, e, m;
+
+  // Identity, status, mothers and daughters, three times charge,
+  // and whether visible (0 or 1).
+  vector<int>  id, status, mother1, mother2, daughter1, daughter2,
+               chargeType;
+  vector<char> visible;
+
+private:
+
+  // Number of entries.
+  int nSave;
+
 };
 
 //==========================================================================
@@ -168,8 +168,8 @@ public:
     return combine(flav1, flav2); }
 
   // Return hadron mass. Used one if present, pick otherwise.
-  virtual double getHadronMassWin(int idHad) { return
-    ((hadronMassWin < 0.0) ? particleDataPtr->mSel(idHad) : hadronMassWin); }
+  virtual double getHadronMassWin(int idHad) { return ((hadronMassWin < 0.0)
+    ? particleDataPtr->mSel(idHad, rndmPtr) : hadronMassWin); }
 
   // Assign popcorn quark inside an original (= rank 0) diquark.
   void assignPopQ(FlavContainer& flav);
@@ -259,6 +259,60 @@ protected:
 
 //==========================================================================
 
+// The LundZTable class tabulates the Lund/Bowler fragmentation function
+// f(z) = (1 - z)^a * exp(-b/z) / z^c for fixed a and c, at nodes in b
+// spaced evenly in ln(b). At each node the range in u = sqrt(z) is split
+// in bins, and the maximum of f in each bin is stored together with the
+// cumulative sum of these maxima. For a b value between two nodes the
+// bin maxima of the two together provide an envelope, so z can be
+// picked from the inverse of the tabulated cumulative distributions
+// and then accepted with the ratio of f to the envelope. This is an
+// exact sampling of f(z), usually with a high efficiency.
+
+class LundZTable {
+
+public:
+
+  // Constructor.
+  LundZTable() : aSave(), cSave(), nB(), nZ(), logBMin(), logBMax(),
+    dLogB() {}
+
+  // Set up the table for given a and c, in a range of b values.
+  void init(double aIn, double cIn, int nBIn, int nZIn, double bMin,
+    double bMax);
+
+  // Shape parameters of the table.
+  double a() const {return aSave;}
+  double c() const {return cSave;}
+
+  // Check whether a b value is inside the tabulated range.
+  bool inRange(double b) const {double logB = log(b);
+    return logB >= logBMin && logB < logBMax;}
+
+  // Pick a z value for a b value inside the tabulated range.
+  double pick(double b, Rndm* rndmPtr) const;
+
+private:
+
+  // Logarithm of the function in u, up to a factor depending on b.
+  double logF(double u, double b) const;
+
+  // Shape parameters and table size.
+  double aSave, cSave;
+  int    nB, nZ;
+  double logBMin, logBMax, dLogB;
+
+  // Per node: b value, logarithm of the overall maximum used as
+  // normalization, and its ratio to that of the next node. For each bin
+  // the normalized maximum and the cumulative sum of maxima, and a guide
+  // to the first bin reached in each of nZ equal slices of the sum.
+  vector<double> bNode, logFNorm, normUpp, fMaxBin, fCumBin;
+  vector<int>    iGuide;
+
+};
+
+//==========================================================================
+
 // The StringZ class is used to sample the fragmentation function f(z).
 
 class StringZ : public PhysicsBase {
@@ -270,7 +324,7 @@ public:
     usePetersonB(), usePetersonH(), mc2(), mb2(), aLund(), bLund(),
     aExtraSQuark(), aExtraDiquark(), rFactC(), rFactB(), rFactH(), aNonC(),
     aNonB(), aNonH(), bNonC(), bNonB(), bNonH(), epsilonC(), epsilonB(),
-    epsilonH(), stopM(), stopNF(), stopS() {}
+    epsilonH(), stopM(), stopNF(), stopS(), useTable(), iTable() {}
 
   // Destructor.
   virtual ~StringZ() {}
@@ -304,7 +358,8 @@ public:
 protected:
 
   // Constants: could only be changed in the code itself.
-  static const double CFROMUNITY, AFROMZERO, AFROMC, EXPMAX;
+  static const double CFROMUNITY, AFROMZERO, AFROMC, EXPMAX, BTABLEMIN,
+                      BTABLEMAX;
 
   // Initialization data, to be read from Settings.
   bool   useNonStandC, useNonStandB, useNonStandH,
@@ -313,6 +368,19 @@ protected:
          rFactB, rFactH, aNonC, aNonB, aNonH, bNonC, bNonB, bNonH,
          epsilonC, epsilonB, epsilonH, stopM, stopNF, stopS;
 
+  // Shape parameters a, b/mT2 and c of the Lund function for given
+  // flavours of the fragmenting and the new parton.
+  void shapeLund(int idFrag, bool isOldSQuark, bool isNewSQuark,
+    bool isOldDiquark, bool isNewDiquark, double mT2, double& aShape,
+    double& bNow, double& cShape) const;
+
+  // Optional tables of the Lund function, with the table to use for
+  // light, c and b fragmenting flavour (first index), and ordinary,
+  // s quark or diquark old (second) and new (third) flavour.
+  bool   useTable;
+  int    iTable[3][3][3];
+  vector<LundZTable> tables;
+
 };
 
 //==========================================================================
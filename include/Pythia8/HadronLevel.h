@@ -32,6 +32,7 @@
 #include "Pythia8/RHadrons.h"
 #include "Pythia8/Settings.h"
 #include "Pythia8/StringFragmentation.h"
+#include "Pythia8/ThreadPool.h"
 #include "Pythia8/TimeShower.h"
 #include "Pythia8/UserHooks.h"
 
@@ -170,6 +171,26 @@ private:
   // Class to displace hadron vertices from parton impact-parameter picture.
   PartonVertexPtr partonVertexPtr;
 
+  // Optional parallel fragmentation of the normal strings of an event.
+  // Each thread has its own fragmentation objects and copy of the event,
+  // and each string its own random numbers. The outcome of each string,
+  // i.e. new entries and changed status and daughters of its partons
+  // and junction legs, is inserted in the event in the original order.
+  class StringWorker;
+  struct StringOutput {
+    bool isOK{};
+    int iJunction{};
+    int statusJunction[3]{};
+    vector<Particle> entries{};
+    vector<int> iChanged{}, statusChanged{}, daughter1Changed{},
+      daughter2Changed{};
+  };
+  shared_ptr<ThreadPool> fragThreadPoolPtr{};
+  vector< shared_ptr<StringWorker> > stringWorkers{};
+  vector<StringOutput> stringOutputs{};
+  bool canFragmentInParallel();
+  int fragmentInParallel(int iSubBeg, Event& event);
+
   // Hadronic rescattering.
   class PriorityNode;
   bool doRescatter{}, scatterManyTimes{}, scatterQuickCheck{},
@@ -192,7 +192,7 @@ public:
     double mIn = 0., double scaleIn = 0., ParticleData* ptr = 0)
     : Particle(idIn, statusIn, mother1In, mother2In, daughter1In, daughter2In,
     colIn, acolIn, pxIn, pyIn, pzIn, eIn, mIn, scaleIn), indexSave() {
-    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( idIn) );
+    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( idIn).get() );
     initRhoD();
     direction = 1; }
   HelicityParticle(int idIn, int statusIn, int mother1In, int mother2In,
@@ -200,13 +200,13 @@ public:
     double mIn = 0., double scaleIn = 0., ParticleData* ptr = 0)
     : Particle(idIn, statusIn, mother1In, mother2In, daughter1In, daughter2In,
     colIn, acolIn, pIn, mIn, scaleIn), indexSave() {
-    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( idIn) );
+    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( idIn).get() );
     initRhoD();
     direction = 1; }
   HelicityParticle(const Particle& ptIn, ParticleData* ptr = 0)
     : Particle(ptIn) {
     indexSave = ptIn.index();
-    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( id()) );
+    if (ptr) setPDEPtr( ptr->particleDataEntryPtr( id()).get() );
     initRhoD();
     direction = 1; }
 
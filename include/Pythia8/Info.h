@@ -108,6 +108,14 @@ public:
   // Pointer to the UserHooks object set for the run.
   UserHooksPtr   userHooksPtr{};
 
+  // Pointer to a store of initialization products shared between
+  // instances. (Is NULL unless set by the user or PythiaParallel.)
+  InitCachePtr   initCachePtr{};
+
+  // Base seed of the random-number streams of initialization steps,
+  // common to all instances of a PythiaParallel run.
+  int            seedInitStreams{Rndm::DEFAULTSEED};
+
   // Pointer to information about a HeavyIons run and the current event.
   // (Is NULL if HeavyIons object is inactive.)
   HIInfo*        hiInfo{};
@@ -268,7 +276,7 @@ public:
   int    iBMPI(int i)         const {return iBMPISave[i];}
 
   // Cross section estimate, optionally process by process.
-  vector<int> codesHard();
+  vector<int> codesHard() const;
 
   // Name of the specified process.
   string nameProc(int i = 0)  const {
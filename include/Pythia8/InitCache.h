@@ -0,0 +1,161 @@
+// InitCache.h is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains the InitCache class, which stores products of the
+// initialization stage, so that they can be shared by several Pythia
+// instances with the same setup, e.g. in PythiaParallel, or be saved
+// on disk for later runs with the same setup.
+
+#ifndef Pythia8_InitCache_H
+#define Pythia8_InitCache_H
+
+#include "Pythia8/PythiaStdlib.h"
+#include "Pythia8/SharedPointers.h"
+#include <condition_variable>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The InitCache class is a thread-safe store of initialization products,
+// each a flat vector of doubles identified by a key string, such as
+// "MultipartonInteractions:0:2212:2212:13000". Products are immutable
+// once stored, and are handed out as reference-counted const pointers,
+// so that any number of instances can read them concurrently. An instance
+// may also claim a product before producing it, so that instances
+// initialized at the same time can wait for it instead of repeating the
+// work, or turn to another task in the meantime.
+
+class InitCache {
+
+public:
+
+  // Constructor.
+  InitCache() : nFoundSave(0), nStoredSave(0) {}
+
+  // Store a product under a key. The first product stored is kept.
+  // Any claim on the key is fulfilled.
+  void set(const string& key, const vector<double>& data) {
+    {
+      lock_guard<mutex> lock(cacheMutex);
+      claims.erase(key);
+      if (products.find(key) == products.end()) {
+        products[key] = make_shared<const vector<double> >(data);
+        ++nStoredSave;
+      }
+    }
+    claimDone.notify_all();
+  }
+
+  // Look up a product. Returns a null pointer if not found.
+  shared_ptr<const vector<double> > get(const string& key) {
+    lock_guard<mutex> lock(cacheMutex);
+    auto iter = products.find(key);
+    if (iter == products.end()) return nullptr;
+    ++nFoundSave;
+    return iter->second;
+  }
+
+  // Store an object derived from a product, such as unpacked tables, so
+  // that the instances using the product can also share the object.
+  // The first object stored is kept, and is returned.
+  shared_ptr<const void> setObject(const string& key,
+    shared_ptr<const void> object) {
+    lock_guard<mutex> lock(cacheMutex);
+    return objects.insert( make_pair(key, object)).first->second;}
+
+  // Look up an object derived from a product. Null pointer if not found.
+  shared_ptr<const void> getObject(const string& key) const {
+    lock_guard<mutex> lock(cacheMutex);
+    auto iter = objects.find(key);
+    return (iter == objects.end()) ? nullptr : iter->second;}
+
+  // Check whether a product is available.
+  bool has(const string& key) const {
+    lock_guard<mutex> lock(cacheMutex);
+    return products.find(key) != products.end();
+  }
+
+  // Claim the right to produce a product. Returns false if it is already
+  // stored or claimed by someone else. A successful claim must always be
+  // followed by a set or a release of the same key.
+  bool claim(const string& key) {
+    lock_guard<mutex> lock(cacheMutex);
+    if (products.find(key) != products.end()) return false;
+    return claims.insert(key).second;
+  }
+
+  // Give up a claim without storing a product, e.g. after a failure.
+  void release(const string& key) {
+    {
+      lock_guard<mutex> lock(cacheMutex);
+      claims.erase(key);
+    }
+    claimDone.notify_all();
+  }
+
+  // Look up a product, first waiting for any claim on it to be settled.
+  // Returns a null pointer if the product was never stored.
+  shared_ptr<const vector<double> > wait(const string& key);
+
+  // Number of products, and of successful lookups and stores so far.
+  int  size()    const {
+    lock_guard<mutex> lock(cacheMutex); return products.size();}
+  long nFound()  const {
+    lock_guard<mutex> lock(cacheMutex); return nFoundSave;}
+  long nStored() const {
+    lock_guard<mutex> lock(cacheMutex); return nStoredSave;}
+
+  // Remove all products, objects derived from them and claims. Any
+  // instance waiting for a claim then finds no product.
+  void clear() {
+    {
+      lock_guard<mutex> lock(cacheMutex);
+      products.clear();
+      objects.clear();
+      claims.clear();
+    }
+    claimDone.notify_all();
+  }
+
+  // Write all products to a binary file, or read them back in. The file
+  // also contains a configuration string, e.g. all changed settings,
+  // and is only read if this string agrees with the current one.
+  bool writeFile(const string& fileName, const string& config) const;
+  bool readFile(const string& fileName, const string& config);
+
+  // Hash of a string, as 16 hexadecimal digits, e.g. for file names.
+  static string hash(const string& text);
+
+  // Random-number seed derived from a key and a base seed, for steps
+  // with an own stream.
+  static int seed(const string& key, int seedBase);
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  // Identifier and format version of the binary file.
+  static const string FILETAG;
+  static const int    FILEVERSION;
+
+  // The products, objects derived from them, the keys claimed but not
+  // yet stored, and a lock for concurrent access, with notification when
+  // a claim is settled.
+  map<string, shared_ptr<const vector<double> > > products;
+  map<string, shared_ptr<const void> > objects;
+  std::set<string> claims;
+  mutable mutex cacheMutex;
+  std::condition_variable claimDone;
+
+  // Statistics, only accessed under the lock.
+  long nFoundSave, nStoredSave;
+
+};
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_InitCache_H
@@ -5,6 +5,8 @@
 
 // This file is written by Stefan Prestel.
 // Header file to allow user access to program at different stages.
+// StateVariables: Container for the state variables of a shower
+//                 branching, as returned by showers for merging.
 // HardProcess: Container class for the hard process to be merged. Holds the
 //              bookkeeping of particles not be be reclustered
 // MergingHooks: Steering class for matrix element merging. Some functions can
@@ -30,6 +32,64 @@ class PartonLevel;
 
 //==========================================================================
 
+// The state variables of a shower branching, e.g. the evolution variable
+// and the scales of couplings and PDFs, as needed for merging.
+// The standard variables are stored in a fixed layout, indexed by an
+// enum, so that they can be set and read without string lookups. Any
+// further variables are kept by name. Conversion to and from the older
+// map<string,double> representation is provided for compatibility.
+
+class StateVariables {
+
+public:
+
+  // Indices of the standard variables.
+  enum Index { T, TRS, SCALEAS, SCALEEM, SCALEPDF, Z, RADBEFID, RADBEFCOL,
+    RADBEFACOL, COUPLINGTYPE, COUPLINGVALUE, M2DIP, NVARIABLES };
+
+  // Constructors.
+  StateVariables() : valueSave(), isSetSave(0) {}
+  StateVariables(const map<string,double>& varsIn) : valueSave(),
+    isSetSave(0) { for (auto it = varsIn.begin(); it != varsIn.end(); ++it)
+      set( it->first, it->second); }
+
+  // Set or read a standard variable. Unset variables read as zero.
+  void   set(Index i, double valueIn) {valueSave[i] = valueIn;
+    isSetSave |= 1u << i;}
+  bool   has(Index i) const {return (isSetSave >> i) & 1u;}
+  double operator[](Index i) const {return valueSave[i];}
+
+  // Check whether no variables have been set.
+  bool   empty() const {return isSetSave == 0 && extra.empty();}
+
+  // Name of a standard variable, and index from name (-1 if none).
+  static const string& name(Index i) {return names[i];}
+  static int index(const string& nameIn);
+
+  // Access by name, to standard or further variables.
+  void   set(const string& nameIn, double valueIn);
+  bool   has(const string& nameIn) const;
+  double get(const string& nameIn, double valueDefault = -1.) const;
+
+  // Conversion to the map<string,double> representation.
+  map<string,double> toMap() const;
+
+  // Further variables, stored by name.
+  map<string,double> extra;
+
+private:
+
+  // Names of the standard variables.
+  static const string names[NVARIABLES];
+
+  // Values of the standard variables, and bit pattern of those set.
+  double   valueSave[NVARIABLES];
+  unsigned isSetSave;
+
+};
+
+//==========================================================================
+
 // Declaration of hard process class
 // This class holds information on the desired hard 2->2 process
 // for the merging.
@@ -140,8 +140,7 @@ public:
 
   // Special setup to allow switching between beam PDFs for MPI handling.
   void initSwitchID( const vector<int>& idAListIn) {
-    idAList = idAListIn; nPDFA = idAList.size();
-    mpis  = vector<MPIInterpolationInfo>(nPDFA);}
+    idAList = idAListIn; nPDFA = idAList.size(); mpisPtr = nullptr;}
 
     // Switch to new beam particle identities, and possibly PDFs.
   void setBeamID(int iPDFAin) { iPDFA = iPDFAin;
@@ -299,7 +298,9 @@ private:
     void init(int nStepIn);
   };
 
-  vector<MPIInterpolationInfo> mpis;
+  // The tables are only read once set up, and are therefore shared with
+  // other instances that take them from the same initialization cache.
+  shared_ptr<const vector<MPIInterpolationInfo> > mpisPtr;
 
   // Beam offset wrt. normal situation and other photon-related parameters.
   int    beamOffset;
@@ -334,6 +335,12 @@ private:
   bool saveMPIdata();
   bool loadMPIdata();
 
+  // Pack or unpack initialization data to/from a flat vector, for sharing
+  // between instances. Set up current values from the stored data.
+  vector<double> packMPIdata() const;
+  bool unpackMPIdata(const vector<double>& data);
+  void useMPIdata();
+
   // Evaluate "Sudakov form factor" for not having a harder interaction.
   double sudakov(double pT2sud, double enhance = 1.);
 
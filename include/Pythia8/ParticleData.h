@@ -42,19 +42,26 @@ public:
     int prod4 = 0, int prod5 = 0, int prod6 = 0, int prod7 = 0)
     : onModeSave(onModeIn), bRatioSave(bRatioIn), currentBRSave(0.),
     onShellWidthSave(0.), openSecPos(1.), openSecNeg(1.),
-    meModeSave(meModeIn), nProd(0), prod(), hasChangedSave(true) {
+    meModeSave(meModeIn), nProd(0), prod(), hasChangedSave(true),
+    nChangeBRPtr(nullptr) {
     prod[0] = prod0; prod[1] = prod1; prod[2] = prod2; prod[3] = prod3;
     prod[4] = prod4; prod[5] = prod5; prod[6] = prod6; prod[7] = prod7;
     for (int j = 0; j < 8; ++j) if (prod[j] != 0 && j == nProd) ++nProd; }
 
-  // Copy constructor.
+  // Copy constructor. A copy only counts its changes once stored in an
+  // entry, so that it never refers to a counter that no longer exists.
   DecayChannel( const DecayChannel& oldDC) {
     onModeSave = oldDC.onModeSave; bRatioSave = oldDC.bRatioSave;
     currentBRSave = oldDC.currentBRSave;
     onShellWidthSave = oldDC.onShellWidthSave; openSecPos = oldDC.openSecPos;
     openSecNeg = oldDC.openSecNeg; meModeSave = oldDC.meModeSave;
     nProd = oldDC.nProd; for (int j = 0; j < 8; ++j) prod[j] = oldDC.prod[j];
-    hasChangedSave = oldDC.hasChangedSave; }
+    hasChangedSave = oldDC.hasChangedSave; nChangeBRPtr = nullptr; }
+
+  // Move constructor, used when the decay table of an entry grows, so
+  // keeps counting changes in the same entry.
+  DecayChannel( DecayChannel&& oldDC) noexcept : DecayChannel(oldDC) {
+    nChangeBRPtr = oldDC.nChangeBRPtr; }
 
   // Assignment operator.
   DecayChannel& operator=( const DecayChannel& oldDC) { if (this != &oldDC) {
@@ -63,13 +70,16 @@ public:
     onShellWidthSave = oldDC.onShellWidthSave; openSecPos = oldDC.openSecPos;
     openSecNeg = oldDC.openSecNeg; meModeSave = oldDC.meModeSave;
     nProd = oldDC.nProd; for (int j = 0; j < 8; ++j) prod[j] = oldDC.prod[j];
-    hasChangedSave = oldDC.hasChangedSave; } return *this; }
+    hasChangedSave = oldDC.hasChangedSave; changedBR();} return *this; }
 
   // Member functions for input.
-  void onMode(int onModeIn) {onModeSave = onModeIn; hasChangedSave = true;}
+  void onMode(int onModeIn) {onModeSave = onModeIn; hasChangedSave = true;
+    changedBR();}
   void bRatio(double bRatioIn, bool countAsChanged = true) {
-    bRatioSave = bRatioIn; if (countAsChanged) hasChangedSave = true;}
-  void rescaleBR(double fac) {bRatioSave *= fac; hasChangedSave = true;}
+    bRatioSave = bRatioIn; if (countAsChanged) hasChangedSave = true;
+    changedBR();}
+  void rescaleBR(double fac) {bRatioSave *= fac; hasChangedSave = true;
+    changedBR();}
   void meMode(int meModeIn) {meModeSave = meModeIn; hasChangedSave = true;}
   void multiplicity(int multIn)  {nProd = multIn; hasChangedSave = true;}
   void product(int i, int prodIn) {prod[i] = prodIn; nProd = 0;
@@ -107,8 +117,17 @@ public:
   double openSec(int idSgn) const {
     return (idSgn > 0) ? openSecPos : openSecNeg;}
 
+  // Counter of on/off switch or branching ratio changes in any channel of
+  // the particle, used to tell when cached channel selection tables are
+  // outdated. Set when the channel is stored in a particle entry.
+  void setChangeCounter(unsigned long* nChangeBRPtrIn) {
+    nChangeBRPtr = nChangeBRPtrIn;}
+
 private:
 
+  // Register an on/off switch or branching ratio change.
+  void changedBR() {if (nChangeBRPtr != nullptr) ++(*nChangeBRPtr);}
+
   // Decay channel info.
   int    onModeSave;
   double bRatioSave, currentBRSave, onShellWidthSave, openSecPos,
@@ -116,6 +135,9 @@ private:
   int    meModeSave, nProd, prod[8];
   bool   hasChangedSave;
 
+  // Change counter of the particle entry the channel belongs to.
+  unsigned long* nChangeBRPtr;
+
 };
 
 //==========================================================================
@@ -140,8 +162,9 @@ public:
     doExternalDecaySave(), isVisibleSave(), doForceWidthSave(),
     hasChangedSave(true), hasChangedMMinSave(false),
     hasChangedMMaxSave(false), modeBWnow(), modeTau0now(), atanLow(),
-    atanDif(), mThr(), currentBRSum(), resonancePtr(0), particleDataPtr() {
-      setDefaults();}
+    atanDif(), mThr(), currentBRSum(), useAliasNow(false), iAliasNow(0),
+    iCurrentBR(-1), nChangeBR(0), hasAlias(), nChangeAlias(), aliasBRSum(),
+    hasSgnDepBR(), resonancePtr(0), particleDataPtr() { setDefaults();}
   ParticleDataEntry(int idIn, string nameIn, string antiNameIn,
     int spinTypeIn = 0, int chargeTypeIn = 0, int colTypeIn = 0,
     double m0In = 0., double mWidthIn = 0., double mMinIn = 0.,
@@ -155,8 +178,10 @@ public:
     doExternalDecaySave(), isVisibleSave(), doForceWidthSave(),
     hasChangedSave(true), hasChangedMMinSave(false),
     hasChangedMMaxSave(false), modeBWnow(), modeTau0now(), atanLow(),
-    atanDif(), mThr(), currentBRSum(), resonancePtr(0), particleDataPtr() {
-      setDefaults(); if (toLower(antiNameIn) == "void") hasAntiSave = false;}
+    atanDif(), mThr(), currentBRSum(), useAliasNow(false), iAliasNow(0),
+    iCurrentBR(-1), nChangeBR(0), hasAlias(), nChangeAlias(), aliasBRSum(),
+    hasSgnDepBR(), resonancePtr(0), particleDataPtr() { setDefaults();
+    if (toLower(antiNameIn) == "void") hasAntiSave = false;}
 
   // Copy constructor.
   ParticleDataEntry( const ParticleDataEntry& oldPDE) {idSave = oldPDE.idSave;
@@ -178,8 +203,17 @@ public:
     mThr = oldPDE.mThr;
     for (int i = 0; i < int(oldPDE.channels.size()); ++i) {
       DecayChannel oldDC = oldPDE.channels[i]; channels.push_back(oldDC); }
-    currentBRSum = oldPDE.currentBRSum; resonancePtr = oldPDE.resonancePtr;
-    particleDataPtr = oldPDE.particleDataPtr; }
+    currentBRSum = oldPDE.currentBRSum; useAliasNow = oldPDE.useAliasNow;
+    iAliasNow = oldPDE.iAliasNow; iCurrentBR = oldPDE.iCurrentBR;
+    nChangeBR = oldPDE.nChangeBR; hasSgnDepBR = oldPDE.hasSgnDepBR;
+    for (int i = 0; i < 2; ++i) {
+      hasAlias[i] = oldPDE.hasAlias[i]; nChangeAlias[i]
+      = oldPDE.nChangeAlias[i]; aliasBRSum[i] = oldPDE.aliasBRSum[i];
+      aliasChan[i] = oldPDE.aliasChan[i]; aliasAlt[i] = oldPDE.aliasAlt[i];
+      aliasProb[i] = oldPDE.aliasProb[i]; }
+    resonancePtr = oldPDE.resonancePtr;
+    particleDataPtr = oldPDE.particleDataPtr;
+    for (DecayChannel& dc : channels) setChangeCounter(dc); }
 
   // Assignment operator.
   ParticleDataEntry& operator=( const ParticleDataEntry& oldPDE) {
@@ -201,8 +235,10 @@ public:
     = oldPDE.atanLow; atanDif = oldPDE.atanDif; mThr = oldPDE.mThr;
     for (int i = 0; i < int(oldPDE.channels.size()); ++i) {
       DecayChannel oldDC = oldPDE.channels[i]; channels.push_back(oldDC); }
-    currentBRSum = oldPDE.currentBRSum; resonancePtr = 0;
-    particleDataPtr = 0; } return *this; }
+    currentBRSum = oldPDE.currentBRSum; useAliasNow = false;
+    iCurrentBR = -1; hasAlias[0] = hasAlias[1] = false; resonancePtr = 0;
+    particleDataPtr = 0; for (DecayChannel& dc : channels)
+      setChangeCounter(dc); } return *this; }
 
   // Initialization of some particle flags.
   void setDefaults();
@@ -309,7 +345,7 @@ public:
   // Set and give back several mass-related quantities.
   void   initBWmass();
   double constituentMass()        const { return constituentMassSave; }
-  double mSel()                   const;
+  double mSel(Rndm* rndmPtrIn = nullptr) const;
   double mRun(double mH)          const;
 
   // Give back other quantities.
@@ -341,14 +377,16 @@ public:
   int    nQuarksInCode(int idQIn)       const;
 
   // Reset to empty decay table.
-  void clearChannels() {channels.resize(0);}
+  void clearChannels() {channels.resize(0);
+    hasAlias[0] = hasAlias[1] = false;}
 
   // Add a decay channel to the decay table.
   void addChannel(int onMode = 0, double bRatio = 0., int meMode = 0,
     int prod0 = 0, int prod1 = 0, int prod2 = 0, int prod3 = 0,
     int prod4 = 0, int prod5 = 0, int prod6 = 0, int prod7 = 0) {
     channels.push_back( DecayChannel( onMode, bRatio, meMode, prod0,
-    prod1, prod2, prod3, prod4, prod5, prod6, prod7) ); }
+    prod1, prod2, prod3, prod4, prod5, prod6, prod7) );
+    setChangeCounter(channels.back()); hasAlias[0] = hasAlias[1] = false; }
 
   // Decay table size.
   int sizeChannels() const {return channels.size();}
@@ -404,6 +442,24 @@ private:
   // Summed branching ratio of currently open channels.
   double currentBRSum;
 
+  // Alias tables for channel selection, for particle [0] and antiparticle
+  // [1], only used for particles with fixed branching ratios. Each slot
+  // holds a channel, the probability to keep it and its alias channel.
+  // The currentBR values of the channels are those of sign iCurrentBR,
+  // if known, and only depend on the sign if hasSgnDepBR.
+  // The decay channels count their on/off switch and branching ratio
+  // changes in nChangeBR, and a table is outdated when this differs from
+  // the count it was set up with.
+  bool   useAliasNow;
+  int    iAliasNow, iCurrentBR;
+  unsigned long  nChangeBR;
+  bool   hasAlias[2];
+  unsigned long  nChangeAlias[2];
+  double aliasBRSum[2];
+  vector<int>    aliasChan[2], aliasAlt[2];
+  vector<double> aliasProb[2];
+  bool   hasSgnDepBR;
+
   // Pointer to ResonanceWidths object; only used for some particles.
   ResonanceWidthsPtr resonancePtr;
 
@@ -413,6 +469,17 @@ private:
   // Set constituent mass.
   void setConstituentMass();
 
+  // Set up alias table for particle or antiparticle decays.
+  void setAliasTable(int iSgn);
+
+  // Set the currentBR values of fixed branching ratios for particle
+  // or antiparticle decays.
+  void setCurrentBR(int iSgn);
+
+  // Let a decay channel count its changes in this entry.
+  void setChangeCounter(DecayChannel& channel) {
+    channel.setChangeCounter(&nChangeBR);}
+
 };
 
 //==========================================================================
@@ -424,14 +491,17 @@ class ParticleData {
 public:
 
   // Constructor.
-  ParticleData() : setRapidDecayVertex(), modeBreitWigner(), maxEnhanceBW(),
+  ParticleData() : setRapidDecayVertex(), useAliasTables(false),
+    modeBreitWigner(), maxEnhanceBW(),
     mQRun(), Lambda5Run(), intermediateTau0(), infoPtr(nullptr),
     settingsPtr(nullptr), rndmPtr(nullptr), coupSMPtr(nullptr),
-    particlePtr(nullptr), isInit(false), readingFailedSave(false) {}
+    nIndexed(0), indexShift(32), particlePtr(nullptr), isInit(false),
+    readingFailedSave(false) {}
 
   // Copy constructor.
   ParticleData( const ParticleData& oldPD) {
     modeBreitWigner = oldPD.modeBreitWigner; maxEnhanceBW = oldPD.maxEnhanceBW;
+    useAliasTables = oldPD.useAliasTables;
     for (int i = 0; i < 7; ++i) mQRun[i] = oldPD.mQRun[i];
     Lambda5Run = oldPD.Lambda5Run; infoPtr = nullptr; settingsPtr = nullptr;
     rndmPtr = nullptr; coupSMPtr = nullptr;
@@ -440,11 +510,12 @@ public:
       pdt[idTmp] = make_shared<ParticleDataEntry>(*pde->second);
       pdt[idTmp]->initPtr(this); }
     particlePtr = nullptr; isInit = oldPD.isInit;
-    readingFailedSave = oldPD.readingFailedSave; }
+    readingFailedSave = oldPD.readingFailedSave; rebuildIndex(); }
 
   // Assignment operator.
   ParticleData& operator=( const ParticleData& oldPD) { if (this != &oldPD) {
     modeBreitWigner = oldPD.modeBreitWigner; maxEnhanceBW = oldPD.maxEnhanceBW;
+    useAliasTables = oldPD.useAliasTables;
     for (int i = 0; i < 7; ++i) mQRun[i] = oldPD.mQRun[i];
     Lambda5Run = oldPD.Lambda5Run; infoPtr = nullptr; settingsPtr = nullptr;
     rndmPtr = nullptr; coupSMPtr = nullptr;
@@ -453,12 +524,14 @@ public:
       pdt[idTmp] = make_shared<ParticleDataEntry>(*pde->second);
       pdt[idTmp]->initPtr(this); }
     particlePtr = nullptr; isInit = oldPD.isInit;
-    readingFailedSave = oldPD.readingFailedSave; } return *this; }
+    readingFailedSave = oldPD.readingFailedSave; rebuildIndex(); }
+    return *this; }
 
-  // Initialize pointers.
+  // Initialize pointers. Also let all entries refer to this object.
   void initPtrs(Info* infoPtrIn) {infoPtr = infoPtrIn;
     settingsPtr = infoPtr->settingsPtr; loggerPtr = infoPtr->loggerPtr;
-    rndmPtr = infoPtr->rndmPtr; coupSMPtr = infoPtr->coupSMPtr;}
+    rndmPtr = infoPtr->rndmPtr; coupSMPtr = infoPtr->coupSMPtr;
+    for (auto& pde : pdt) pde.second->initPtr(this);}
 
   // Read in database from specific file.
   bool init(string startFile = "../share/Pythia8/xmldoc/ParticleData.xml") {
@@ -471,6 +544,9 @@ public:
   // Read in database from an istream.
   bool init(istream& is) { initCommon(); return readXML(is);}
 
+  // Read in database in binary form, as written by writeBinary(...).
+  bool initBinary(istream& is) { initCommon(); return readBinary(is);}
+
   // Overwrite existing database by reading from specific file.
   bool reInit(string startFile, bool xmlFormat = true) { initCommon();
     return (xmlFormat) ? readXML(startFile) : readFF(startFile);}
@@ -496,6 +572,11 @@ public:
   bool readFF(istream& is, bool reset = true);
   void listFF(string outFile);
 
+  // Write whole database in binary form, or read it back in, as a faster
+  // alternative to the XML file at construction.
+  bool writeBinary(ostream& os);
+  bool readBinary(istream& is);
+
   // Read in one update from a single line.
   bool readString(string lineIn, bool warn = true) ;
 
@@ -535,7 +616,7 @@ public:
     pdt[abs(idIn)] = make_shared<ParticleDataEntry>(idIn, nameIn, spinTypeIn,
       chargeTypeIn, colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn, tau0In,
       varWidthIn);
-    pdt[abs(idIn)]->initPtr(this); }
+    pdt[abs(idIn)]->initPtr(this); addToIndex(abs(idIn)); }
   void addParticle(int idIn, string nameIn, string antiNameIn,
     int spinTypeIn = 0, int chargeTypeIn = 0, int colTypeIn = 0,
     double m0In = 0., double mWidthIn = 0., double mMinIn = 0.,
@@ -543,40 +624,39 @@ public:
     pdt[abs(idIn)] = make_shared<ParticleDataEntry>(idIn, nameIn, antiNameIn,
       spinTypeIn, chargeTypeIn, colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn,
       tau0In, varWidthIn);
-    pdt[abs(idIn)]->initPtr(this); }
+    pdt[abs(idIn)]->initPtr(this); addToIndex(abs(idIn)); }
 
   // Reset all the properties of an entry in one go.
   void setAll(int idIn, string nameIn, string antiNameIn,
     int spinTypeIn = 0, int chargeTypeIn = 0, int colTypeIn = 0,
     double m0In = 0., double mWidthIn = 0., double mMinIn = 0.,
     double mMaxIn = 0.,double tau0In = 0.,bool varWidthIn = false) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setAll( nameIn, antiNameIn, spinTypeIn, chargeTypeIn,
     colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn, tau0In, varWidthIn); }
 
   // Query existence of an entry.
-  bool isParticle(int idIn) const {
-    auto found = pdt.find( abs(idIn) );
-    if ( found == pdt.end() ) return false;
-    if ( idIn > 0 || found->second->hasAnti() ) return true;
-    return false;
-  }
+  bool isParticle(int idIn) const { return findSlot(idIn) >= 0; }
 
-  // Query existence of an entry and return an iterator.
+  // Query existence of an entry and return a shared pointer to it.
   ParticleDataEntryPtr findParticle(int idIn) {
-    auto found = pdt.find( abs(idIn) );
-    if( found == pdt.end() ) return nullptr;
-    if ( idIn > 0 || found->second->hasAnti() ) return found->second;
-    return nullptr;
-  }
+    int iSlot = findSlot(idIn);
+    return (iSlot < 0) ? nullptr : indexEntries[iSlot]; }
 
-  // Query existence of an entry and return a const iterator.
+  // Query existence of an entry and return a const shared pointer to it.
   const ParticleDataEntryPtr findParticle(int idIn) const {
-    auto found = pdt.find( abs(idIn) );
-    if( found == pdt.end() ) return nullptr;
-    if ( idIn > 0 || found->second->hasAnti() ) return found->second;
-    return nullptr;
-  }
+    int iSlot = findSlot(idIn);
+    return (iSlot < 0) ? nullptr : indexEntries[iSlot]; }
+
+  // Query existence of an entry and return a non-owning pointer to it.
+  // Faster than findParticle, since no reference count is updated.
+  // Only valid as long as the entry is not replaced or removed.
+  ParticleDataEntry* findEntry(int idIn) {
+    int iSlot = findSlot(idIn);
+    return (iSlot < 0) ? nullptr : indexEntries[iSlot].get(); }
+  const ParticleDataEntry* findEntry(int idIn) const {
+    int iSlot = findSlot(idIn);
+    return (iSlot < 0) ? nullptr : indexEntries[iSlot].get(); }
 
   // Return the id of the sequentially next particle stored in table.
   int nextId(int idIn) const;
@@ -587,229 +667,229 @@ public:
 
   // Change current values one at a time (or set if not set before).
   void name(int idIn, string nameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setName(nameIn); }
   void antiName(int idIn, string antiNameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setAntiName(antiNameIn); }
   void names(int idIn, string nameIn, string antiNameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setNames(nameIn, antiNameIn); }
   void spinType(int idIn, int spinTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setSpinType(spinTypeIn); }
   void chargeType(int idIn, int chargeTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setChargeType(chargeTypeIn); }
   void colType(int idIn, int colTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setColType(colTypeIn); }
   void m0(int idIn, double m0In) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setM0(m0In); }
   void mWidth(int idIn, double mWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMWidth(mWidthIn); }
   void mMin(int idIn, double mMinIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMMin(mMinIn); }
   void mMax(int idIn, double mMaxIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMMax(mMaxIn); }
   void tau0(int idIn, double tau0In) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setTau0(tau0In); }
   void isResonance(int idIn, bool isResonanceIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setIsResonance(isResonanceIn); }
   void mayDecay(int idIn, bool mayDecayIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMayDecay(mayDecayIn); }
   void tauCalc(int idIn, bool tauCalcIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setTauCalc(tauCalcIn); }
   void doExternalDecay(int idIn, bool doExternalDecayIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setDoExternalDecay(doExternalDecayIn); }
   void varWidth(int idIn, bool varWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setVarWidth(varWidthIn); }
   void isVisible(int idIn, bool isVisibleIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setIsVisible(isVisibleIn); }
   void doForceWidth(int idIn, bool doForceWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setDoForceWidth(doForceWidthIn); }
   void hasChanged(int idIn, bool hasChangedIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setHasChanged(hasChangedIn); }
 
   // Give back current values.
   bool hasAnti(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasAnti() : false; }
   int antiId(int idIn) const {
     if (idIn < 0) return -idIn;
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->antiId() : 0; }
   string name(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->name(idIn) : " "; }
   int spinType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->spinType() : 0; }
   int chargeType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->chargeType(idIn) : 0; }
   double charge(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->charge(idIn) : 0; }
   int colType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->colType(idIn) : 0 ; }
   double m0(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0() : 0. ; }
   double mWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mWidth() : 0. ; }
   double mMin(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mMin() : 0. ; }
   double m0Min(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0Min() : 0. ; }
   double mMax(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mMax() : 0. ; }
   double m0Max(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0Max() : 0. ; }
   double tau0(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->tau0() : 0. ; }
   bool isResonance(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isResonance() : false ; }
   bool mayDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mayDecay() : false ; }
   bool tauCalc(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->tauCalc() : false ; }
   bool doExternalDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->doExternalDecay() : false ; }
   bool isVisible(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isVisible() : false ; }
   bool doForceWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->doForceWidth() : false ; }
   bool hasChanged(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChanged() : false ; }
   bool hasChangedMMin(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChangedMMin() : false ; }
   bool hasChangedMMax(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChangedMMax() : false ; }
 
   // Give back special mass-related quantities.
   bool useBreitWigner(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->useBreitWigner() : false ; }
   bool varWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->varWidth() : false; }
   double constituentMass(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->constituentMass() : 0. ; }
-  double mSel(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
-    return ( ptr ) ? ptr->mSel() : 0. ; }
+  double mSel(int idIn, Rndm* rndmPtrIn = nullptr) const {
+    const ParticleDataEntry* ptr = findEntry(idIn);
+    return ( ptr ) ? ptr->mSel(rndmPtrIn) : 0. ; }
   double mRun(int idIn, double mH) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mRun(mH) : 0. ; }
 
   // Give back other quantities.
   bool canDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->canDecay() : false ; }
   bool isLepton(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isLepton() : false ; }
   bool isQuark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isQuark() : false ; }
   bool isGluon(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isGluon() : false ; }
   bool isDiquark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isDiquark() : false ; }
   bool isParton(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isParton() : false ; }
   bool isHadron(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isHadron() : false ; }
   bool isMeson(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isMeson() : false ; }
   bool isBaryon(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isBaryon() : false ; }
   bool isOnium(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isOnium() : false ; }
   bool isExotic(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isExotic() : false ; }
   bool isOctetHadron(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isOctetHadron() : false ; }
   int heaviestQuark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->heaviestQuark(idIn) : 0 ; }
   int baryonNumberType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->baryonNumberType(idIn) : 0 ; }
   int nQuarksInCode(int idIn, int idQIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->nQuarksInCode(idQIn) : 0 ; }
 
   // Change branching ratios.
   void rescaleBR(int idIn, double newSumBR = 1.) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->rescaleBR(newSumBR); }
 
   // Access methods stored in ResonanceWidths.
   void setResonancePtr(int idIn, ResonanceWidthsPtr resonancePtrIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setResonancePtr( resonancePtrIn);}
   void resInit(int idIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->resInit(infoPtr);}
   double resWidth(int idIn, double mHat, int idInFlav = 0,
     bool openOnly = false, bool setBR = false) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidth(idIn, mHat,
     idInFlav, openOnly, setBR) : 0.;}
   double resWidthOpen(int idIn, double mHat, int idInFlav = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthOpen(idIn, mHat, idInFlav) : 0.;}
   double resWidthStore(int idIn, double mHat, int idInFlav = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthStore(idIn, mHat, idInFlav) : 0.;}
   double resOpenFrac(int id1In, int id2In = 0, int id3In = 0);
   double resWidthRescaleFactor(int idIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthRescaleFactor() : 0.;}
   double resWidthChan(int idIn, double mHat, int idAbs1 = 0,
     int idAbs2 = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthChan( mHat, idAbs1, idAbs2) : 0.;}
 
   // Return pointer to entry.
@@ -823,7 +903,7 @@ public:
 private:
 
   // Common data, accessible for the individual particles.
-  bool   setRapidDecayVertex;
+  bool   setRapidDecayVertex, useAliasTables;
   int    modeBreitWigner;
   double maxEnhanceBW, mQRun[7], Lambda5Run, intermediateTau0;
 
@@ -848,6 +928,42 @@ private:
   // All particle data stored in a map.
   map<int, ParticleDataEntryPtr> pdt;
 
+  // Open-addressing hash index into the map, for fast lookup by id.
+  // Slot i holds the absolute id indexIds[i] (-1 if empty) and the entry
+  // indexEntries[i]. The size is a power of two, 2^(32 - indexShift),
+  // at most half filled.
+  vector<int> indexIds;
+  vector<ParticleDataEntryPtr> indexEntries;
+  int nIndexed, indexShift;
+
+  // Entries that have been replaced or removed from the map. They are
+  // kept alive as long as this object, since particles in an event record,
+  // also one copied before a re-initialization, may still point to them
+  // through their non-owning particle data pointer.
+  vector<ParticleDataEntryPtr> retiredEntries;
+
+  // Slot to start searching from, by Fibonacci hashing of the id, i.e.
+  // the top bits of the 32-bit product.
+  int hashSlot(int idAbs) const { return int( uint32_t( uint32_t(idAbs)
+    * 2654435769u) >> indexShift ); }
+
+  // Find the index slot of an entry, or -1 if none. Antiparticles are
+  // only found if the entry has an antiparticle.
+  int findSlot(int idIn) const {
+    if (indexIds.empty()) return -1;
+    int idAbs = abs(idIn);
+    int mask  = int(indexIds.size()) - 1;
+    for (int i = hashSlot(idAbs); ; i = (i + 1) & mask) {
+      if (indexIds[i] == idAbs)
+        return (idIn > 0 || indexEntries[i]->hasAnti()) ? i : -1;
+      if (indexIds[i] < 0) return -1;
+    }
+  }
+
+  // Rebuild the whole index from the map, or add or update one entry.
+  void rebuildIndex();
+  void addToIndex(int idAbs);
+
   // Pointer to current particle (e.g. when reading decay channels).
   ParticleDataEntryPtr particlePtr;
 
@@ -871,6 +987,9 @@ private:
   // Vector of strings containing the readable lines of the XML file.
   vector<string> xmlFileSav;
 
+  // Stored copy of the database in binary form, if read in that way.
+  string binarySav;
+
   // Stored history of readString statements (common and by subrun).
   vector<string> readStringHistory;
   map<int, vector<string> > readStringSubrun;
@@ -82,6 +82,10 @@ public:
   // Read out parton density.
   double xf(int id, double x, double Q2);
 
+  // Read out parton density for a batch of (x, Q2) points.
+  void xfBatch(int id, const vector<double>& x, const vector<double>& Q2,
+    vector<double>& xfOut);
+
   // Read out valence and sea part of parton densities.
   double xfVal(int id, double x, double Q2);
   double xfSea(int id, double x, double Q2);
@@ -223,35 +227,50 @@ public:
   LHAGrid1(int idBeamIn = 2212, string pdfWord = "void",
     string xmlPath = "../share/Pythia8/xmldoc/", Logger* loggerPtr = 0)
     : PDF(idBeamIn), doExtraPol(false), nx(), nq(), nqSub(), xMin(), xMax(),
-    qMin(), qMax(), pdfVal(), pdfGrid(), pdfSlope(nullptr) {
+    qMin(), qMax(), pdfVal(), pdfGrid(nullptr), pdfSlope(nullptr) {
     init( pdfWord, xmlPath, loggerPtr); };
 
   // Constructor with a stream.
   LHAGrid1(int idBeamIn, istream& is, Logger* loggerPtr = 0)
     : PDF(idBeamIn), doExtraPol(false), nx(), nq(), nqSub(), xMin(), xMax(),
-    qMin(), qMax(), pdfVal(), pdfGrid(), pdfSlope(nullptr) {
+    qMin(), qMax(), pdfVal(), pdfGrid(nullptr), pdfSlope(nullptr) {
     init( is, loggerPtr); };
 
-  // Destructor.
-  ~LHAGrid1() { for (int iid = 0; iid < 12; ++iid) {
-    for (int iq = 0; iq < nq; ++iq) delete[] pdfGrid[iid][iq];
-    delete[] pdfGrid[iid]; }
-    if (pdfSlope) { for (int iid = 0; iid < 12; ++iid) delete[] pdfSlope[iid];
-    delete[] pdfSlope;} };
-
   // Allow extrapolation beyond boundaries. This is optional.
   void setExtrapolate(bool doExtraPolIn) override {doExtraPol = doExtraPolIn;}
 
 private:
 
-  // Variables to be set during code initialization.
+  // The grid data read from file. It is never changed after reading,
+  // and is therefore shared between all objects that use the same file,
+  // e.g. the two beams or the instances of a PythiaParallel run.
+  // The PDF values are stored contiguously, with the 12 flavours of a
+  // given (x, Q) point next to each other, as element
+  // (iq * nx + ix) * 12 + iid, so that all flavours are interpolated
+  // together in a vectorizable loop over neighbouring memory.
+  // Correspondingly the small-x slopes are stored as iq * 12 + iid.
+  struct GridData {
+    GridData() : nx(), nq(), nqSub(), xMin(), xMax(), qMin(), qMax() {}
+    int    nx, nq, nqSub;
+    vector<int> nqSum;
+    double xMin, xMax, qMin, qMax;
+    vector<double> xGrid, lnxGrid, qGrid, lnqGrid, qDiv;
+    vector<double> pdfGrid, pdfSlope;
+  };
+  shared_ptr<const GridData> gridDataPtr;
+
+  // Grids already read, by file name, and a lock for access to them.
+  static map<string, weak_ptr<const GridData> > gridCache;
+  static mutex gridCacheMutex;
+
+  // Variables to be set during code initialization, copied from grid data.
   bool   doExtraPol;
   int    nx, nq, nqSub;
   vector<int> nqSum;
   double xMin, xMax, qMin, qMax, pdfVal[12];
   vector<double> xGrid, lnxGrid, qGrid, lnqGrid, qDiv;
-  double** pdfGrid[12];
-  double** pdfSlope;
+  const double* pdfGrid;
+  const double* pdfSlope;
 
   // These inits do not overwrite PDF init (prevents Clang warnings).
   using PDF::init;
@@ -262,6 +281,10 @@ private:
   // Initialization through a stream.
   void init( istream& is, Logger* loggerPtr);
 
+  // Read in data grid from stream, and set up to use a data grid.
+  shared_ptr<const GridData> readGrid( istream& is, Logger* loggerPtr);
+  void useGrid( shared_ptr<const GridData> gridDataPtrIn);
+
   // Update PDF values.
   void xfUpdate(int id, double x, double Q2) override;
 
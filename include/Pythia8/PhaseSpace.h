@@ -36,6 +36,51 @@ class UserHooks;
 
 //==========================================================================
 
+// The AdaptiveGrid class is a one-dimensional VEGAS-style grid on the
+// unit interval. Each bin is picked with the same probability, and the
+// bin edges are adapted so that each bin carries the same share of the
+// integrand, as estimated from accumulated weighted points.
+
+class AdaptiveGrid {
+
+public:
+
+  // Constructor.
+  AdaptiveGrid() : nBin(0) {}
+
+  // Set up with bins of equal width.
+  void init(int nBinIn);
+
+  // Value for a uniform random number, and probability density at a value.
+  double pick(double r) const;
+  double density(double u) const;
+
+  // Accumulate a weighted point, and adapt the bins to the points so far.
+  void accumulate(double u, double wt) {sums[bin(u)] += wt;}
+  void adapt();
+
+  // Append the bin edges to, or read them back from, a flat vector.
+  void getEdges(vector<double>& data) const;
+  bool setEdges(const vector<double>& data, int& iData);
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  static const double DAMPING;
+
+  // Find the bin of a value.
+  int bin(double u) const {
+    return int(upper_bound( edges.begin() + 1, edges.end() - 1, u)
+      - edges.begin()) - 1;}
+
+  // The bin edges, and the accumulated weights in each bin.
+  int nBin;
+  vector<double> edges, sums;
+
+};
+
+//==========================================================================
+
 // PhaseSpace is a base class for  phase space generators
 // used in the selection of hard-process kinematics.
 
@@ -68,6 +113,14 @@ public:
   // is to be selected in the derived class.
   virtual bool trialKin(bool inEvent = true, bool repeatSame = false) = 0;
 
+  // Store or restore the outcome of setupSampling as a flat vector, so
+  // that it can be shared between instances with the same setup. It is
+  // restored from index iData onwards, so that it can be read directly
+  // from a larger shared product.
+  // Only available for the standard 2 -> 1, 2 -> 2 and 2 -> 3 cases.
+  virtual bool getSampling(vector<double>& ) const {return false;}
+  virtual bool setSampling(const vector<double>& , int ) {return false;}
+
   // A pure virtual method, wherein the accepted event kinematics
   // is to be constructed in the derived class.
   virtual bool finalKin() = 0;
@@ -89,6 +142,13 @@ public:
   // For Les Houches with negative event weight needs
   virtual double sigmaSumSigned() const {return sigmaMx;}
 
+  // Adaptive grid: whether tried and kept, and the estimated unweighting
+  // efficiency at initialization without and with it.
+  bool   triedGrid()        const {return useGrid;}
+  bool   usesGrid()         const {return gridFrac > 0.;}
+  double efficiencyNoGrid() const {return effNoGrid;}
+  double efficiencyGrid()   const {return effGrid;}
+
   // Give back constructed four-vectors and known masses.
   Vec4   p(int i)   const {return pH[i];}
   double m(int i)   const {return mH[i];}
@@ -155,10 +215,12 @@ protected:
     zCoefSum(), useBW(), useNarrowBW(), idMass(), mPeak(), sPeak(), mWidth(),
     mMin(), mMax(), mw(), wmRat(), mLower(), mUpper(), sLower(), sUpper(),
     fracFlatS(), fracFlatM(), fracInv(), fracInv2(), atanLower(), atanUpper(),
-    intBW(), intFlatS(), intFlatM(), intInv(), intInv2() {}
+    intBW(), intFlatS(), intFlatM(), intInv(), intInv2(), useGrid(),
+    nGridBins(), nGridIter(), nGridPoints(), gridFracSet(), gridFrac(),
+    effNoGrid(), effGrid(), uTauGrid(), uYGrid(), uZGrid() {}
 
   // Constants: could only be changed in the code itself.
-  static const int    NMAXTRY, NTRY3BODY;
+  static const int    NMAXTRY, NTRY3BODY, NSAMPLING123;
   static const double SAFETYMARGIN, TINY, EVENFRAC, SAMESIGMA, MRESMINABS,
                       WIDTHMARGIN, SAMEMASS, MASSMARGIN, EXTRABWWTMAX,
                       THRESHOLDSIZE, THRESHOLDSTEP, YRANGEMARGIN, LEPTONXMIN,
@@ -213,6 +275,11 @@ protected:
   void setup3Body();
   bool setupSampling123(bool is2, bool is3);
 
+  // Store or restore the outcome of setupSampling123.
+  void getSampling123(vector<double>& data) const;
+  bool setSampling123(bool is2, bool is3, const vector<double>& data,
+    int& iData);
+
   // Select a trial kinematics phase space point.
   bool trialKin123(bool is2, bool is3, bool inEvent = true);
 
@@ -236,12 +303,16 @@ protected:
   double tauCoef[8], yCoef[8], zCoef[8], tauCoefSum[8], yCoefSum[8],
          zCoefSum[8];
 
+  // Select a trial phase space point and find its cross section.
+  bool trialPoint123(bool is2, bool is3, bool inEvent);
+
   // Calculate kinematical limits for 2 -> 1/2/3.
   bool limitTau(bool is2, bool is3);
   bool limitY();
   bool limitZ();
 
   // Select kinematical variable between defined limits for 2 -> 1/2/3.
+  // A negative index keeps the current value and only finds its weight.
   void selectTau(int iTau, double tauVal, bool is2);
   void selectY(int iY, double yVal);
   void selectZ(int iZ, double zVal);
@@ -259,6 +330,15 @@ protected:
          fracFlatM[6], fracInv[6], fracInv2[6], atanLower[6], atanUpper[6],
          intBW[6], intFlatS[6], intFlatM[6], intInv[6], intInv2[6];
 
+  // Optional adaptive grids in tau, y and z for 2 -> 2, each used as an
+  // extra channel picked with fraction gridFrac, with the scaled
+  // variables of the current point.
+  bool   useGrid;
+  int    nGridBins, nGridIter, nGridPoints;
+  double gridFracSet, gridFrac, effNoGrid, effGrid, uTauGrid, uYGrid,
+         uZGrid;
+  AdaptiveGrid gridTau, gridY, gridZ;
+
   // Setup mass selection for one resonance at a time. Split in two parts.
   void   setupMass1(int iM);
   void   setupMass2(int iM, double distToThresh);
@@ -307,6 +387,14 @@ public:
   virtual bool setupSampling() {if (!setupMass()) return false;
     return setupSampling123(false, false);}
 
+  // Store or restore the outcome of setupSampling.
+  virtual bool getSampling(vector<double>& data) const {
+    getSampling123(data); return true;}
+  virtual bool setSampling(const vector<double>& data, int iData) {
+    if (!setupMass() || int(data.size()) != iData + NSAMPLING123)
+      return false;
+    return setSampling123(false, false, data, iData);}
+
   // Construct the trial kinematics.
   virtual bool trialKin(bool inEvent = true, bool = false) {wtBW = 1.;
     return trialKin123(false, false, inEvent);}
@@ -332,9 +420,14 @@ public:
   // Constructor.
   PhaseSpace2to2tauyz() {}
 
-  // Optimize subsequent kinematics selection.
+  // Optimize subsequent kinematics selection, optionally with grids.
   virtual bool setupSampling() {if (!setupMasses()) return false;
-    return setupSampling123(true, false);}
+    if (!setupSampling123(true, false)) return false;
+    return (useGrid) ? trainGrid() : true;}
+
+  // Store or restore the outcome of setupSampling.
+  virtual bool getSampling(vector<double>& data) const;
+  virtual bool setSampling(const vector<double>& data, int iData);
 
   // Construct the trial kinematics.
   virtual bool trialKin(bool inEvent = true, bool = false) {
@@ -362,6 +455,13 @@ private:
   // Select fixed or Breit-Wigner-distributed masses.
   bool trialMasses();
 
+  // Train the adaptive grids, and keep them if they pay off.
+  bool trainGrid();
+
+  // Sample trial points for the grids, and return the mean cross section
+  // and an extrapolated maximum.
+  double sampleGrid(bool doAdapt, double& sigmaMaxNow);
+
   // Pick off-shell initialization masses when on-shell not allowed.
   bool constrainedM3M4();
   bool constrainedM3();
@@ -528,6 +628,14 @@ public:
   virtual bool setupSampling() {if (!setupMasses()) return false;
     setup3Body(); return setupSampling123(false, true);}
 
+  // Store or restore the outcome of setupSampling.
+  virtual bool getSampling(vector<double>& data) const {
+    getSampling123(data); return true;}
+  virtual bool setSampling(const vector<double>& data, int iData) {
+    if (!setupMasses() || int(data.size()) != iData + NSAMPLING123)
+      return false;
+    setup3Body(); return setSampling123(false, true, data, iData);}
+
   // Construct the trial kinematics.
   virtual bool trialKin(bool inEvent = true, bool = false) {
     if (!trialMasses()) return false;
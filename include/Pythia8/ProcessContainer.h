@@ -56,12 +56,18 @@ public:
       beamAhasResGamma(), beamBhasResGamma(), beamHasResGamma(),
       beamHasGamma(), beamAgammaMode(), beamBgammaMode(), gammaModeEvent(),
       approximatedGammaFlux(), nTryRequested(), nSelRequested(),
-      nAccRequested(), sigmaTemp(), sigma2Temp(), normVar3() {}
+      nAccRequested(), sigmaTemp(), sigma2Temp(), normVar3(),
+      isFirstSave(true), separateStreams(false), isDeferredSave(false),
+      initSourceSave(0), initTimeSave(0.) {}
 
   // Initialize phase space and counters.
   bool init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
     SLHAinterface* slhaInterfacePtr, GammaKinematics* gammaKinPtrIn);
 
+  // Finish the initialization if the maximum search was left to another
+  // instance sharing the initialization cache, see isDeferred().
+  bool initDeferred();
+
   // Store or replace Les Houches pointer.
   void setLHAPtr( LHAupPtr lhaUpPtrIn,  ParticleData* particleDataPtrIn = 0,
     Settings* settingsPtrIn = 0, Rndm* rndmPtrIn = 0)
@@ -152,6 +158,20 @@ public:
   long   nSelectedLHA(int i) const {return nSelLHA[i];}
   long   nAcceptedLHA(int i) const {return nAccLHA[i];}
 
+  // Info on the maximum search in init: whether it was left to another
+  // instance, the time spent on it, and the source of the outcome,
+  // 0 = found here, 1 = taken from cache, 2 = waited for another instance.
+  bool   isDeferred()  const {return isDeferredSave;}
+  double initTime()    const {return initTimeSave;}
+  int    initSource()  const {return initSourceSave;}
+
+  // Info on adaptive phase-space grids: whether tried and used, and the
+  // unweighting efficiency estimated at init without and with them.
+  bool   triedGrid()        const {return phaseSpacePtr->triedGrid();}
+  bool   usesGrid()         const {return phaseSpacePtr->usesGrid();}
+  double efficiencyNoGrid() const {return phaseSpacePtr->efficiencyNoGrid();}
+  double efficiencyGrid()   const {return phaseSpacePtr->efficiencyGrid();}
+
   // When two hard processes set or get info whether process is matched.
   void   isSame( bool isSameIn) { isSameSave = isSameIn;}
   bool   isSame()      const {return isSameSave;}
@@ -180,6 +200,7 @@ private:
   bool   matchInOut;
   int    idRenameBeams, setLifetime, setQuarkMass, setLeptonMass, idNewM[9];
   double mRecalculate, mNewM[9];
+  void   initLesHouches();
 
   // Info on process.
   bool   isLHA, isNonDiff, isResolved, isDiffA, isDiffB, isDiffC, isQCD3body,
@@ -217,6 +238,12 @@ private:
   // Estimate integrated cross section and its uncertainty.
   void sigmaDelta();
 
+  // Find maximum of differential cross section * phasespace.
+  bool   isFirstSave, separateStreams, isDeferredSave;
+  int    initSourceSave;
+  double initTimeSave;
+  bool   findMaximum(bool waitForOthers);
+
 };
 
 //==========================================================================
@@ -107,11 +107,13 @@ private:
   vector<ProcessContainer*> containerPtrs;
   int    iContainer, iLHACont = -1;
   double sigmaMaxSum;
+  vector<double> sigmaMaxCum;
 
   // Ditto for optional choice of a second hard process.
   vector<ProcessContainer*> container2Ptrs;
   int    i2Container;
   double sigma2MaxSum;
+  vector<double> sigma2MaxCum;
 
   // Single half-dummy container for LHA input of resonance decay only.
   ProcessContainer containerLHAdec;
@@ -128,6 +130,20 @@ private:
   // Samples photon kinematics from leptons.
   GammaKinematics gammaKin;
 
+  // Initialize a set of processes, and return the number switched on.
+  int initContainers( vector<ProcessContainer*>& containers, bool isFirst);
+
+  // Print the time spent on initializing each process.
+  void printInitTimes();
+
+  // Sum up the cross section maxima of a set of processes, and store
+  // the cumulative sums used to pick one of them.
+  double sumSigmaMax( vector<ProcessContainer*>& containers,
+    vector<double>& sigmaCum, bool doSwitch = false);
+
+  // Pick a process according to the cumulative cross section maxima.
+  int pickContainer( const vector<double>& sigmaCum, double sigmaSum);
+
   // Generate the next event with one interaction.
   bool nextOne( Event& process);
 
@@ -146,6 +162,9 @@ private:
   // Print statistics when two hard processes allowed.
   void statistics2(bool reset);
 
+  // Print unweighting efficiencies of adaptive phase-space grids.
+  void statisticsGrid();
+
 };
 
 //==========================================================================
@@ -23,6 +23,7 @@
 #include "Pythia8/HadronLevel.h"
 #include "Pythia8/HadronWidths.h"
 #include "Pythia8/Info.h"
+#include "Pythia8/InitCache.h"
 #include "Pythia8/JunctionSplitting.h"
 #include "Pythia8/LesHouches.h"
 #include "Pythia8/Logger.h"
@@ -116,13 +117,16 @@ public:
     PDFPtr pdfUnresAPtrIn = nullptr, PDFPtr pdfUnresBPtrIn = nullptr,
     PDFPtr pdfUnresGamAPtrIn = nullptr, PDFPtr pdfUnresGamBPtrIn = nullptr,
     PDFPtr pdfVMDAPtrIn = nullptr, PDFPtr pdfVMDBPtrIn = nullptr) {
+      hasUserPDFPtrs = pdfAPtrIn || pdfBPtrIn;
       return beamSetup.setPDFPtr( pdfAPtrIn, pdfBPtrIn, pdfHardAPtrIn,
       pdfHardBPtrIn, pdfPomAPtrIn, pdfPomBPtrIn, pdfGamAPtrIn, pdfGamBPtrIn,
       pdfHardGamAPtrIn, pdfHardGamBPtrIn, pdfUnresAPtrIn, pdfUnresBPtrIn,
       pdfUnresGamAPtrIn, pdfUnresGamBPtrIn, pdfVMDAPtrIn, pdfVMDBPtrIn); }
   bool setPDFAPtr( PDFPtr pdfAPtrIn ) {
+    hasUserPDFPtrs = pdfAPtrIn != nullptr;
     return beamSetup.setPDFAPtr( pdfAPtrIn); }
   bool setPDFBPtr( PDFPtr pdfBPtrIn ) {
+    hasUserPDFPtrs = pdfBPtrIn != nullptr;
     return beamSetup.setPDFBPtr( pdfBPtrIn); }
 
   // Set photon fluxes externally. Used with option "PDF:lepton2gammaSet = 2".
@@ -222,6 +226,16 @@ public:
   bool setPartonVertexPtr( PartonVertexPtr partonVertexPtrIn)
     { partonVertexPtr = partonVertexPtrIn; return true;}
 
+  // Possibility to pass in pointer to a store of initialization products,
+  // shared with other instances that have the same setup.
+  bool setInitCachePtr( InitCachePtr initCachePtrIn)
+    { infoPrivate.initCachePtr = initCachePtrIn; return true;}
+
+  // Write the default settings and particle data databases in binary
+  // form, by default to the xmldoc directory, for a faster construction
+  // of later Pythia objects.
+  bool writeDatabase(string fileName = "");
+
   // Initialize.
   bool init();
 
@@ -389,6 +403,22 @@ private:
   // Initialise user provided plugins.
   void initPlugins();
 
+  // Read in the settings and particle data databases in binary form,
+  // provided that the file is up to date with the XML files.
+  bool readDatabase(string fileName);
+
+  // Configuration string identifying the setup, for the on-disk cache
+  // of initialization products.
+  string initCacheConfig();
+
+  // Reason why the setup cannot be identified by its configuration
+  // string, i.e. user objects that may change the initialization
+  // products. Empty if there is none.
+  string initCacheUserObjects();
+
+  // Flag whether PDF pointers have been set by the user.
+  bool hasUserPDFPtrs = false;
+
   // Functions to be called at the beginning and end of a next() call.
   void beginEvent();
   void endEvent(PhysicsBase::Status status);
@@ -407,6 +437,9 @@ private:
 
   // Constants: could only be changed in the code itself.
   static const double VERSIONNUMBERHEAD, VERSIONNUMBERCODE;
+  // Name, identifier and format version of the binary database file.
+  static const string DATABASEFILE, DATABASETAG;
+  static const int    DATABASEVERSION;
   // Maximum number of tries to produce parton level from given input.
   // Negative integer to denote that no subrun has been set.
   static const int    NTRY = 10;
@@ -424,7 +457,7 @@ private:
 
   // Initialization data, from init(...) call, plus some event-specific.
   bool   isConstructed = {}, isInit = {}, showSaV = {}, showMaD = {},
-         doReconnect = {}, forceHadronLevelCR = {};
+         doReconnect = {}, forceHadronLevelCR = {}, hasOwnInitCache = {};
   int    nCount = {}, nShowLHA = {}, nShowInfo = {}, nShowProc = {},
          nShowEvt = {}, reconnectMode = {};
 
@@ -47,8 +47,9 @@ public:
   // Perform the specified action for each instance in parallel.
   void foreachAsync(function<void(Pythia*)> action);
 
-  // Write final statistics, combining errors from each Pythia instance.
-  void stat() { pythiaHelper.stat(); }
+  // Write final statistics, combining errors from each Pythia instance,
+  // and the scheduling statistics of the latest run.
+  void stat();
 
   // Generate events in parallel.
   vector<long> run(long nEvents, function<void(Pythia*)> callback);
@@ -86,10 +87,33 @@ private:
   bool processAsync;
   bool balanceLoad;
   bool doNext;
+  int chunkSize;
+  int numConsumers;
 
   // Internal Pythia objects.
   vector<unique_ptr<Pythia> > pythiaObjects;
 
+  // Constants: could only be changed in the code itself.
+  static const double TIMEMIN;
+  static const int    NTIMEDECADE, NTIMEBIN;
+
+  // Scheduling statistics for each thread in the latest run, with a
+  // histogram of event generation times, logarithmic in time.
+  struct ThreadStat {
+    long   nEvents = 0, nChunks = 0, nSteals = 0;
+    double timeGen = 0., timeCallback = 0., timeActive = 0., timeMax = 0.;
+    vector<long> timeBins;
+  };
+  vector<ThreadStat> threadStats;
+
+  // Wall-clock time of the latest run, and histogram and maximum of the
+  // event generation times of all threads.
+  double timeRun = 0., eventTimeMax = 0.;
+  vector<long> eventTimeBins;
+
+  // Print the scheduling statistics of the latest run.
+  void runStatistics() const;
+
 };
 
 //==========================================================================
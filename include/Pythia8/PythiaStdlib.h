@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <cmath>
 #include <cstdlib>
+#include <cstdint>
 #include <algorithm>
 #include <memory>
 #include <functional>
@@ -137,6 +138,7 @@ using std::shared_ptr;
 using std::weak_ptr;
 using std::unique_ptr;
 using std::dynamic_pointer_cast;
+using std::static_pointer_cast;
 using std::make_shared;
 
 // Threading.
@@ -215,6 +217,35 @@ inline string toString(int val) {return to_string(val);}
 // Convert a double to a string.
 string toString(double val);
 
+// Write a value of fixed size, a string or a vector in binary form.
+template<typename T> inline void putBinary(ostream& os, T val) {
+  os.write( (const char*) &val, sizeof(T));}
+inline void putBinary(ostream& os, const string& text) {
+  putBinary(os, int(text.size())); os.write( text.data(), text.size());}
+template<typename T> inline void putBinary(ostream& os, const vector<T>& vec)
+  {putBinary(os, int(vec.size())); for (T val : vec) putBinary(os, val);}
+
+// Read back a value of fixed size, a string or a vector. Lengths above
+// maxSize are treated as corrupt input.
+template<typename T> inline bool getBinary(istream& is, T& val) {
+  return bool(is.read( (char*) &val, sizeof(T)));}
+inline bool getBinary(istream& is, string& text, int maxSize = 100000000) {
+  int n = -1;
+  if (!getBinary(is, n) || n < 0 || n > maxSize) return false;
+  text.resize(n);
+  return n == 0 || bool(is.read( &text[0], n));}
+template<typename T> inline bool getBinary(istream& is, vector<T>& vec,
+  int maxSize = 100000000) {
+  int n = -1;
+  if (!getBinary(is, n) || n < 0 || n > maxSize) return false;
+  vec.resize(n);
+  for (int i = 0; i < n; ++i) {
+    T val;
+    if (!getBinary(is, val)) return false;
+    vec[i] = val;
+  }
+  return true;}
+
 //==========================================================================
 
 // Print a method name using the appropriate pre-processor macro.
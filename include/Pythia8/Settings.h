@@ -188,6 +188,35 @@ public:
 
 //==========================================================================
 
+// Handle to the current value of a flag, mode, parm or word. It is
+// obtained once from Settings, by name, and can then be read repeatedly
+// without any string manipulation or lookup. It stays valid as long as
+// the Settings database is not read in anew or assigned to. An invalid
+// handle gives back the default-constructed value.
+
+template<typename T> class SettingHandle {
+
+public:
+
+  // Constructor.
+  SettingHandle(const T* valPtrIn = nullptr) : valPtr(valPtrIn) {}
+
+  // Check that the handle refers to an existing setting.
+  bool isValid() const {return valPtr != nullptr;}
+
+  // Give back current value.
+  T operator()() const {return (valPtr != nullptr) ? *valPtr : T();}
+  operator T() const {return (*this)();}
+
+private:
+
+  // Pointer to the current value in the Settings database.
+  const T* valPtr;
+
+};
+
+//==========================================================================
+
 // This class holds info on flags (bool), modes (int), parms (double),
 // words (string), fvecs (vector of bool), mvecs (vector of int),
 // pvecs (vector of double) and wvecs (vector of string).
@@ -224,6 +253,15 @@ public:
   bool writeFile(ostream& os = cout, bool writeAll = false) ;
   bool writeFileXML(ostream& os = cout) ;
 
+  // Write the complete database in binary form, or read it back in,
+  // as a faster alternative to the XML files at construction.
+  bool writeBinary(ostream& os) const;
+  bool readBinary(istream& is);
+
+  // Names of the files read in by init(...), e.g. to check whether a
+  // binary copy of the database is up to date.
+  const vector<string>& initFiles() const {return initFilesSave;}
+
   // Print out table of database, either all or only changed ones,
   // or ones containing a given string.
   void listAll() { list( true, false, " "); }
@@ -296,6 +334,12 @@ public:
   vector<double> pvec(string keyIn);
   vector<string> wvec(string keyIn);
 
+  // Give back handle to current value, with check that key exists.
+  SettingHandle<bool>   flagHandle(string keyIn);
+  SettingHandle<int>    modeHandle(string keyIn);
+  SettingHandle<double> parmHandle(string keyIn);
+  SettingHandle<string> wordHandle(string keyIn);
+
   // Give back default value, with check that key exists.
   bool   flagDefault(string keyIn);
   int    modeDefault(string keyIn);
@@ -387,6 +431,9 @@ public:
   // Set of loaded plugin libraries.
   set<string> pluginLibraries;
 
+  // Files read in by init(...).
+  vector<string> initFilesSave;
+
   // Flags that initialization has been performed; whether any failures.
   bool isInit, readingFailedSave;
 
@@ -43,6 +43,8 @@ typedef shared_ptr<HeavyIons> HeavyIonsPtr;
 class HIUserHooks;
 typedef shared_ptr<HIUserHooks> HIUserHooksPtr;
 
+class InitCache;
+typedef shared_ptr<InitCache> InitCachePtr;
 class LHAup;
 typedef shared_ptr<LHAup> LHAupPtr;
 
@@ -65,6 +65,12 @@ public:
   // Properties needed for the evaluation of parameter variations
   double pAccept;
 
+  // Parton densities saved from a previous evolution step, with the beam
+  // state, daughter and scale they were evaluated for.
+  int    beamStateSave{-1}, idDauSave{0}, nFlavourSave{0};
+  double xDauSave{0}, pT2PDFSave{0}, xPDFdauSave{0}, xPDFgMoSave{0},
+         xPDFmoSave[21]{};
+
 } ;
 
 //==========================================================================
@@ -83,7 +89,8 @@ public:
     useFixedFacScale(), doSecondHard(), canVetoEmission(), hasUserHooks(),
     alphaSuseCMW(), singleWeakEmission(), vetoWeakJets(), weakExternal(),
     doRapidityOrderMPI(), doMPI(), doDipoleRecoil(), doPartonVertex(),
-    pTmaxMatch(), pTdampMatch(), alphaSorder(), alphaSnfmax(), alphaEMorder(),
+    doCachePDF(), pTmaxMatch(), pTdampMatch(), alphaSorder(), alphaSnfmax(),
+    alphaEMorder(),
     nQuarkIn(), enhanceScreening(), weakMode(), pT0paramMode(), pTdampFudge(),
     mc(), mb(), m2c(), m2b(), renormMultFac(), factorMultFac(),
     fixedFacScale2(), alphaSvalue(), alphaS2pi(), Lambda3flav(), Lambda4flav(),
@@ -98,7 +105,8 @@ public:
     m2ColPair(), mColPartner(), m2ColPartner(), m2Dip(), m2Rec(), pT2damp(),
     pTbegRef(), pdfScale2(), doTrialNow(), canEnhanceEmission(),
     canEnhanceTrial(), canEnhanceET(), iDipNow(), iSysNow(), dipEndNow(),
-    iDipSel(), dipEndSel() { beamOffset = 0; pdfMode = 0; }
+    iDipSel(), dipEndSel(), cachePDFNow(), beamStateNow(-1) {
+    beamOffset = 0; pdfMode = 0; }
 
   // Destructor.
   virtual ~SimpleSpaceShower() override {}
@@ -181,7 +189,7 @@ private:
          doPhiPolAsymHard, doPhiIntAsym, doRapidityOrder, useFixedFacScale,
          doSecondHard, canVetoEmission, hasUserHooks, alphaSuseCMW,
          singleWeakEmission, vetoWeakJets, weakExternal, doRapidityOrderMPI,
-         doMPI, doDipoleRecoil, doPartonVertex;
+         doMPI, doDipoleRecoil, doPartonVertex, doCachePDF;
   int    pdfModeSave;
   int    pTmaxMatch, pTdampMatch, alphaSorder, alphaSnfmax, alphaEMorder,
          nQuarkIn, enhanceScreening, weakMode, pT0paramMode;
@@ -229,6 +237,16 @@ private:
   int iDipSel;
   SpaceDipoleEnd* dipEndSel;
 
+  // Reuse of saved parton densities in current step. Counter of changes
+  // of the beam states, which enter all parton densities, and the last
+  // recorded states.
+  bool cachePDFNow;
+  int  beamStateNow;
+  vector<double> beamStateLast;
+
+  // Record the beam states and count any change since last call.
+  void updateBeamState();
+
   // Evolve a QCD dipole end.
   void pT2nextQCD( double pT2begDip, double pT2endDip);
 
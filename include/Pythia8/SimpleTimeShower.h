@@ -70,6 +70,13 @@ public:
          pT2, m2, z, mFlavour, asymPol, flexFactor, pAccept;
   double m2A{0}, m2B{0}, m2C{0}, m2gg{-1};
 
+  // Cached trial emission, with the dipole properties and evolution range
+  // it was generated for, to be reused by pTnext as long as these agree.
+  bool   hasTrial{false};
+  int    iRadTrial{-1}, iRecTrial{-1}, colTypeTrial{0}, MEtypeTrial{0};
+  double mRadTrial{0}, mRecTrial{0}, mDipTrial{0}, flexTrial{0},
+         pT2begTrial{0}, pT2endTrial{0}, pT2Trial{0};
+
   // Pointer to an onium emission object, if present.
   shared_ptr<SplitOnia> emissionPtr{};
 
@@ -94,8 +101,9 @@ public:
     setLambdaHV(), globalRecoil(), useLocalRecoilNow(), doSecondHard(),
     hasUserHooks(), singleWeakEmission(), alphaSuseCMW(), vetoWeakJets(),
     allowMPIdipole(), weakExternal(), recoilDeadCone(), doDipoleRecoil(),
-    doPartonVertex(), pTmaxMatch(), pTdampMatch(), alphaSorder(),
-    alphaSnfmax(), nGluonToQuark(), weightGluonToQuark(), recoilStrategyRF(),
+    doPartonVertex(), doCacheTrials(), pTmaxMatch(), pTdampMatch(),
+    alphaSorder(), alphaSnfmax(), nGluonToQuark(), weightGluonToQuark(),
+    recoilStrategyRF(),
     alphaEMorder(), nGammaToQuark(), nGammaToLepton(), nCHV(), nFlavHV(),
     idHV(), alphaHVorder(), nMaxGlobalRecoil(), weakMode(), pTdampFudge(),
     mc(), mb(), m2c(), m2b(), renormMultFac(), factorMultFac(),
@@ -227,7 +235,7 @@ private:
          brokenHVsym, setLambdaHV, globalRecoil, useLocalRecoilNow,
          doSecondHard, hasUserHooks, singleWeakEmission, alphaSuseCMW,
          vetoWeakJets, allowMPIdipole, weakExternal, recoilDeadCone,
-         doDipoleRecoil, doPartonVertex;
+         doDipoleRecoil, doPartonVertex, doCacheTrials;
   int    pdfModeSave;
   int    pTmaxMatch, pTdampMatch, alphaSorder, alphaSnfmax, nGluonToQuark,
          weightGluonToQuark, recoilStrategyRF, alphaEMorder, nGammaToQuark,
@@ -287,6 +295,10 @@ private:
   // Special setup for onium.
   void regenerateOniumDipoles(Event & event);
 
+  // Evolve a QCD dipole end, or reuse its cached trial emission.
+  void pT2nextQCDcached( double pT2begDip, double pT2endAll,
+    TimeDipoleEnd& dip, Event& event);
+
   // Evolve a QCD dipole end.
   void pT2nextQCD( double pT2begDip, double pT2sel, TimeDipoleEnd& dip,
     Event& event);
@@ -344,8 +356,11 @@ private:
   // hard event (to distinguish between S and H), maximally allowed number of
   // global recoil branchings.
   int nHard, nFinalBorn, nMaxGlobalBranch;
+  SettingHandle<int> nFinalBornSet;
   // Number of proposed splittings in hard scattering systems.
   map<int,int> nProposed;
+  // Handles to settings that are checked for each new dipole.
+  SettingHandle<bool> setProductionScalesLHEF, setDipoleScalesLHEF;
   // Number of splittings with global recoil (currently only 1).
   int nGlobal, globalRecoilMode;
   // Switch to constrain recoiling system.
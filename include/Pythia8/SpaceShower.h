@@ -127,6 +127,14 @@ public:
   virtual map<string, double> getStateVariables (const Event& , int , int ,
     int , string ) { return map<string,double>();}
 
+  // Return the same evolution variable(s) in a fixed layout, which is
+  // faster to fill and read. By default converted from the map above, so
+  // that a shower only needs to implement one of the two methods.
+  // Usage: stateVariables( event, iRad, iEmt, iRec,  name)
+  virtual StateVariables stateVariables(const Event& event, int iRad,
+    int iEmt, int iRec, const string& name) { return StateVariables(
+    getStateVariables( event, iRad, iEmt, iRec, name) ); }
+
   // Check if attempted clustering is handled by spacelike shower.
   // Usage: isSpacelike( event, iRad, iEmt, iRec, name)
   virtual bool isSpacelike(const Event&, int, int, int, string)
@@ -35,19 +35,22 @@ class StringEnd {
 public:
 
   // Constructor.
-  StringEnd() : particleDataPtr(), flavSelPtr(), pTSelPtr(), zSelPtr(),
-    fromPos(), thermalModel(), mT2suppression(), iEnd(), iMax(), idHad(),
-    iPosOld(), iNegOld(), iPosNew(), iNegNew(), hadSoFar(), colOld(), colNew(),
-    pxOld(), pyOld(), pxNew(), pyNew(), pxHad(), pyHad(), mHad(), mT2Had(),
-    zHad(), GammaOld(), GammaNew(), xPosOld(), xPosNew(), xPosHad(), xNegOld(),
-    xNegNew(), xNegHad(), aLund(), bLund(), iPosOldPrev(), iNegOldPrev(),
-    colOldPrev(), pxOldPrev(), pyOldPrev(), GammaOldPrev(), xPosOldPrev(),
-    xNegOldPrev() {}
-
-  // Save pointers.
+  StringEnd() : particleDataPtr(), rndmPtr(), flavSelPtr(), pTSelPtr(),
+    zSelPtr(), fromPos(), thermalModel(), mT2suppression(), iEnd(), iMax(),
+    idHad(), iPosOld(), iNegOld(), iPosNew(), iNegNew(), hadSoFar(), colOld(),
+    colNew(), pxOld(), pyOld(), pxNew(), pyNew(), pxHad(), pyHad(), mHad(),
+    mT2Had(), zHad(), GammaOld(), GammaNew(), xPosOld(), xPosNew(), xPosHad(),
+    xNegOld(), xNegNew(), xNegHad(), aLund(), bLund(), iPosOldPrev(),
+    iNegOldPrev(), colOldPrev(), pxOldPrev(), pyOldPrev(), GammaOldPrev(),
+    xPosOldPrev(), xNegOldPrev() {}
+
+  // Save pointers. Optionally a random number generator for hadron masses,
+  // else the one of the particle data table.
   void init( ParticleData* particleDataPtrIn, StringFlav* flavSelPtrIn,
-    StringPT* pTSelPtrIn, StringZ* zSelPtrIn, Settings& settings) {
-    particleDataPtr = particleDataPtrIn; flavSelPtr = flavSelPtrIn;
+    StringPT* pTSelPtrIn, StringZ* zSelPtrIn, Settings& settings,
+    Rndm* rndmPtrIn = nullptr) {
+    particleDataPtr = particleDataPtrIn; rndmPtr = rndmPtrIn;
+    flavSelPtr = flavSelPtrIn;
     flavSelNow = *flavSelPtr;
     pTSelPtr = pTSelPtrIn; zSelPtr = zSelPtrIn;
     bLund = zSelPtr->bAreaLund(); aLund = zSelPtr->aAreaLund();
@@ -86,8 +89,9 @@ public:
   // Constants: could only be changed in the code itself.
   static const double TINY, PT2SAME, MEANMMIN, MEANM, MEANPT;
 
-  // Pointer to the particle data table.
+  // Pointer to the particle data table and random number generator.
   ParticleData* particleDataPtr;
+  Rndm*         rndmPtr;
 
   // Pointers to classes for flavour, pT and z generation.
   StringFlav*   flavSelPtr;
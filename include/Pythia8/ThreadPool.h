@@ -0,0 +1,84 @@
+// ThreadPool.h is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains the ThreadPool class, a small set of persistent
+// helper threads that can share the work of a loop over independent tasks
+// within a single Pythia instance.
+
+#ifndef Pythia8_ThreadPool_H
+#define Pythia8_ThreadPool_H
+
+#include "Pythia8/PythiaStdlib.h"
+#include <condition_variable>
+#include <exception>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The ThreadPool class keeps nThreads - 1 helper threads waiting for work.
+// A call to run(nTask, task) executes task(i) for i = 0, ..., nTask - 1,
+// spread over the helper threads and the calling thread, and returns
+// when all tasks are done. Tasks must be independent of each other, and
+// which thread executes which task is not predictable, so tasks should
+// only write to their own part of the output. If a task throws, no further
+// tasks are started, and the first exception is rethrown by run() in the
+// calling thread once all threads have stopped working on the batch.
+// Calls to run() should not be nested, nor be made from several threads
+// at the same time.
+
+class ThreadPool {
+
+public:
+
+  // Constructor starts the helper threads.
+  ThreadPool(int nThreadsIn = 1);
+
+  // Destructor stops and joins the helper threads.
+  ~ThreadPool();
+
+  // Not copyable.
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Total number of threads, including the calling one.
+  int nThreads() const { return int(helpers.size()) + 1; }
+
+  // Execute task(i) for i = 0, ..., nTask - 1 and wait for completion.
+  void run(int nTask, const function<void(int)>& task);
+
+private:
+
+  // Main loop of each helper thread.
+  void helperMain();
+
+  // Execute tasks of the current batch until none are left.
+  void work();
+
+  // The helper threads.
+  vector<thread> helpers;
+
+  // Synchronization of the helpers with the calling thread.
+  mutex poolMutex;
+  std::condition_variable wakeUp, allDone;
+  long batchNow;
+  int nBusy;
+  bool stopNow;
+
+  // The current batch of tasks.
+  const function<void(int)>* taskPtr;
+  int nTaskNow;
+  atomic<int> iTaskNext;
+
+  // The first exception thrown by a task of the current batch.
+  std::exception_ptr taskException;
+
+};
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_ThreadPool_H
@@ -302,7 +302,7 @@ void bind_Pythia8_Info(std::function< pybind11::module &(std::string const &name
 		cl.def("pTMPI", (double (Pythia8::Info::*)(int) const) &Pythia8::Info::pTMPI, "C++: Pythia8::Info::pTMPI(int) const --> double", pybind11::arg("i"));
 		cl.def("iAMPI", (int (Pythia8::Info::*)(int) const) &Pythia8::Info::iAMPI, "C++: Pythia8::Info::iAMPI(int) const --> int", pybind11::arg("i"));
 		cl.def("iBMPI", (int (Pythia8::Info::*)(int) const) &Pythia8::Info::iBMPI, "C++: Pythia8::Info::iBMPI(int) const --> int", pybind11::arg("i"));
-		cl.def("codesHard", (class std::vector<int, class std::allocator<int> > (Pythia8::Info::*)()) &Pythia8::Info::codesHard, "C++: Pythia8::Info::codesHard() --> class std::vector<int, class std::allocator<int> >");
+		cl.def("codesHard", (class std::vector<int, class std::allocator<int> > (Pythia8::Info::*)() const) &Pythia8::Info::codesHard, "C++: Pythia8::Info::codesHard() const --> class std::vector<int, class std::allocator<int> >");
 		cl.def("nameProc", [](Pythia8::Info const &o) -> std::string { return o.nameProc(); }, "");
 		cl.def("nameProc", (std::string (Pythia8::Info::*)(int) const) &Pythia8::Info::nameProc, "C++: Pythia8::Info::nameProc(int) const --> std::string", pybind11::arg("i"));
 		cl.def("nTried", [](Pythia8::Info const &o) -> long { return o.nTried(); }, "");
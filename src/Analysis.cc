@@ -69,6 +69,58 @@ bool Sphericity::analyze(const Event& event) {
     denom += pWeight * p2Now;
   }
 
+  // Find eigenvalues and eigenvectors.
+  return diagonalize( tt, denom, nStudy);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze event, already stored in columnar form.
+
+bool Sphericity::analyze(const EventColumns& cols) {
+
+  // Initial values, tensor and counters zero.
+  eVal1 = eVal2 = eVal3 = 0.;
+  eVec1 = eVec2 = eVec3 = 0.;
+  double tt[4][4];
+  for (int j = 1; j < 4; ++j)
+  for (int k = j; k < 4; ++k) tt[j][k] = 0.;
+  int nStudy = 0;
+  double denom = 0.;
+
+  // Loop over desired particles, as for the full event.
+  for (int i = 0; i < cols.size(); ++i)
+  if (cols.isFinal(i)) {
+    if (select >  2 &&  cols.isNeutral(i) ) continue;
+    if (select == 2 && !cols.isVisible(i) ) continue;
+    ++nStudy;
+
+    // Calculate matrix to be diagonalized. Special cases for speed.
+    double pNow[4];
+    pNow[1] = cols.px[i];
+    pNow[2] = cols.py[i];
+    pNow[3] = cols.pz[i];
+    double p2Now = pNow[1]*pNow[1] + pNow[2]*pNow[2] + pNow[3]*pNow[3];
+    double pWeight = 1.;
+    if (powerInt == 1) pWeight = 1. / sqrt(max(P2MIN, p2Now));
+    else if (powerInt == 0) pWeight = pow( max(P2MIN, p2Now), powerMod);
+    for (int j = 1; j < 4; ++j)
+    for (int k = j; k < 4; ++k) tt[j][k] += pWeight * pNow[j] * pNow[k];
+    denom += pWeight * p2Now;
+  }
+
+  // Find eigenvalues and eigenvectors.
+  return diagonalize( tt, denom, nStudy);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find eigenvalues and eigenvectors of the summed momentum tensor.
+
+bool Sphericity::diagonalize(double tt[4][4], double denom, int nStudy) {
+
   // Very low multiplicities (0 or 1) not considered.
   if (nStudy < NSTUDYMIN) {
     if (nFew < TIMESTOPRINT) cout << " PYTHIA Error in "
@@ -232,16 +284,14 @@ bool Thrust::analyze(const Event& event) {
   // Initial values and counters zero.
   eVal1 = eVal2 = eVal3 = 0.;
   eVec1 = eVec2 = eVec3 = 0.;
-  int nStudy = 0;
   vector<Vec4> pOrder;
-  Vec4 pSum, nRef, pPart, pFull, pMax;
+  Vec4 pSum;
 
   // Loop over desired particles in the event.
   for (int i = 0; i < event.size(); ++i)
   if (event[i].isFinal()) {
     if (select >  2 &&  event[i].isNeutral() ) continue;
     if (select == 2 && !event[i].isVisible() ) continue;
-    ++nStudy;
 
     // Store momenta. Use energy component for absolute momentum.
     Vec4 pNow = event[i].p();
@@ -250,6 +300,51 @@ bool Thrust::analyze(const Event& event) {
     pOrder.push_back(pNow);
   }
 
+  // Find thrust and major axes.
+  return findAxes( pOrder, pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze event, already stored in columnar form.
+
+bool Thrust::analyze(const EventColumns& cols) {
+
+  // Initial values and counters zero.
+  eVal1 = eVal2 = eVal3 = 0.;
+  eVec1 = eVec2 = eVec3 = 0.;
+  vector<Vec4> pOrder;
+  Vec4 pSum;
+
+  // Loop over desired particles, as for the full event.
+  for (int i = 0; i < cols.size(); ++i)
+  if (cols.isFinal(i)) {
+    if (select >  2 &&  cols.isNeutral(i) ) continue;
+    if (select == 2 && !cols.isVisible(i) ) continue;
+
+    // Store momenta. Use energy component for absolute momentum.
+    Vec4 pNow = cols.p(i);
+    pNow.e(pNow.pAbs());
+    pSum += pNow;
+    pOrder.push_back(pNow);
+  }
+
+  // Find thrust and major axes.
+  return findAxes( pOrder, pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find thrust and major axes from the selected momenta, with the
+// absolute momentum stored as energy component.
+
+bool Thrust::findAxes(vector<Vec4>& pOrder, const Vec4& pSum) {
+
+  int nStudy = pOrder.size();
+  Vec4 nRef, pPart, pFull, pMax;
+
   // Very low multiplicities (0 or 1) not considered.
   if (nStudy < NSTUDYMIN) {
     if (nFew < TIMESTOPRINT) cout << " PYTHIA Error in "
@@ -925,7 +1020,7 @@ bool SlowJet::setup(const Event& event) {
 
   // Loop over final particles in the event.
   Vec4   pTemp;
-  double mTemp, pT2Temp, mTTemp, yTemp, phiTemp;
+  double mTemp;
   for (int i = 0; i < event.size(); ++i)
   if (event[i].isFinal()) {
 
@@ -956,14 +1051,90 @@ bool SlowJet::setup(const Event& event) {
     }
 
     // Store particle momentum, including some derived quantities.
-    pT2Temp  = max( TINY*TINY, pTemp.pT2());
-    mTTemp  = sqrt( mTemp*mTemp + pT2Temp);
-    yTemp   = (pTemp.pz() > 0)
-            ? log( max( TINY, pTemp.e() + pTemp.pz() ) / mTTemp )
-            : log( mTTemp / max( TINY, pTemp.e() - pTemp.pz() ) );
-    phiTemp = pTemp.phi();
-    clusters.push_back( SingleSlowJet(pTemp, pT2Temp, yTemp, phiTemp, i) );
+    addCluster( pTemp, mTemp, i);
   }
+
+  // Set up initial distances.
+  return setupDistances();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up list of particles to analyze, already stored in columnar form,
+// and initial distances. Not possible with a SlowJetHook, which needs
+// access to the full event.
+
+bool SlowJet::setup(const EventColumns& cols) {
+
+  // A hook requires the full event.
+  if (!noHook) {
+    cout << " PYTHIA Error in SlowJet::setup: SlowJetHook requires "
+         << "the full Event as input" << endl;
+    return false;
+  }
+
+  // Initial values zero.
+  clusters.resize(0);
+  jets.resize(0);
+  jtSize = 0;
+
+  // Loop over final particles in the event.
+  Vec4   pTemp;
+  double mTemp;
+  for (int i = 0; i < cols.size(); ++i)
+  if (cols.isFinal(i)) {
+
+    // Always apply selection options for visible or charged particles.
+    if      (chargedOnly &&  cols.isNeutral(i) ) continue;
+    else if (visibleOnly && !cols.isVisible(i) ) continue;
+
+    // Pseudorapidity cut to describe detector range.
+    pTemp = cols.p(i);
+    if (cutInEta) {
+      double pTNow  = pTemp.pT();
+      double etaNow = log( ( pTemp.pAbs() + abs(pTemp.pz()) )
+                    / max( TINY, pTNow ) );
+      if (etaNow > etaMax) continue;
+    }
+
+    // Optionally modify mass and energy.
+    mTemp = cols.m[i];
+    if (modifyMass) {
+      mTemp = (massSet == 0 || cols.id[i] == 22) ? 0. : PIMASS;
+      pTemp.e( sqrt(pTemp.pAbs2() + mTemp*mTemp) );
+    }
+    addCluster( pTemp, mTemp, i);
+  }
+
+  // Set up initial distances.
+  return setupDistances();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Store particle momentum as a new cluster, including some derived
+// quantities.
+
+void SlowJet::addCluster(const Vec4& pTemp, double mTemp, int i) {
+
+  double pT2Temp = max( TINY*TINY, pTemp.pT2());
+  double mTTemp  = sqrt( mTemp*mTemp + pT2Temp);
+  double yTemp   = (pTemp.pz() > 0)
+    ? log( max( TINY, pTemp.e() + pTemp.pz() ) / mTTemp )
+    : log( mTTemp / max( TINY, pTemp.e() - pTemp.pz() ) );
+  double phiTemp = pTemp.phi();
+  clusters.push_back( SingleSlowJet(pTemp, pT2Temp, yTemp, phiTemp, i) );
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up initial distances between the stored clusters and to beams.
+
+bool SlowJet::setupDistances() {
+
   origSize = clusters.size();
 
   // Done here for FJcore machinery.
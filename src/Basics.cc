@@ -31,6 +31,9 @@ bool Rndm::rndmEnginePtr( RndmEnginePtr rndmEngPtrIn) {
   rndmEngPtr      = rndmEngPtrIn;
   useExternalRndm = true;
 
+  // Numbers left in the buffer are not handed out after the switch.
+  dropBuffer();
+
   // Done.
   return true;
 
@@ -85,6 +88,43 @@ void Rndm::init(int seedIn) {
   initRndm = true;
   stateSave.seed = seed;
   stateSave.sequence = 0;
+  iBuffer = nBuffer = 0;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Initialize quickly from a 64-bit seed. The 97 numbers of the lag table
+// are filled with the 24 upper bits of the SplitMix64 sequence, which is
+// much faster than the standard seeding, but otherwise as in init.
+
+void Rndm::initSubStream(uint64_t seedIn) {
+
+  // Fill the random number array.
+  uint64_t x = seedIn;
+  for (int ii = 0; ii < 97; ++ii) {
+    x += 0x9e3779b97f4a7c15ULL;
+    uint64_t z = x;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    stateSave.u[ii] = double(z >> 40) / 16777216.;
+  }
+
+  // Initialize other variables.
+  double twom24 = 1.;
+  for (int i24 = 0; i24 < 24; ++i24) twom24 *= 0.5;
+  stateSave.c   = 362436. * twom24;
+  stateSave.cd  = 7654321. * twom24;
+  stateSave.cm  = 16777213. * twom24;
+  stateSave.i97 = 96;
+  stateSave.j97 = 32;
+
+  // Finished.
+  initRndm = true;
+  stateSave.seed = 0;
+  stateSave.sequence = 0;
+  iBuffer = nBuffer = 0;
 
 }
 
@@ -184,9 +224,9 @@ pair<Vec4, Vec4> Rndm::phaseSpace2Debug(string loc, string file, int line,
 
 //--------------------------------------------------------------------------
 
-// Generate next random number uniformly between 0 and 1.
+// Refill the buffer of random numbers, when empty, and return the first.
 
-double Rndm::flat() {
+double Rndm::flatFill() {
 
   // Use external random number generator if such has been linked.
   if (useExternalRndm) return rndmEngPtr->flat();
@@ -194,18 +234,97 @@ double Rndm::flat() {
   // Ensure that already initialized.
   if (!initRndm) init(DEFAULTSEED);
 
-  // Find next random number and update saved state.
-  ++stateSave.sequence;
+  // Save state before filling, so that the exact state can be found.
+  stateBuffer = stateSave;
+  generate(buffer, NBUFFER);
+  nBuffer = NBUFFER;
+  iBuffer = 1;
+  return buffer[0];
+
+}
+
+//--------------------------------------------------------------------------
+
+// Generate n random numbers uniformly between 0 and 1 into an array.
+// The Marsaglia-Zaman-Tsang algorithm forms each number from the ones
+// 97 and 33 steps back, so up to 33 consecutive numbers are independent
+// of each other. They are therefore generated in segments of at most
+// that length, where no index wraps around, so that the inner loop can
+// be vectorized. The result is the same as for n single steps.
+
+void Rndm::generate(double* out, int n) {
+
+  // Local copies of the state.
+  double* u  = stateSave.u;
+  int i97    = stateSave.i97;
+  int j97    = stateSave.j97;
+  double c   = stateSave.c;
+  double cd  = stateSave.cd;
+  double cm  = stateSave.cm;
+  double cSeg[NSEGMENT];
+
+  // Loop over segments until all numbers found.
+  int nDone = 0;
+  while (nDone < n) {
+    int nSeg = min( min( n - nDone, int(NSEGMENT)), min( i97, j97) + 1);
+
+    // The carry sequence is cheap but serial.
+    for (int k = 0; k < nSeg; ++k) {
+      c -= cd;
+      c += cm * double(c < 0.);
+      cSeg[k] = c;
+    }
+
+    // The lagged-Fibonacci part, with independent iterations.
+    double* uI = u + i97;
+    double* uJ = u + j97;
+    double* outSeg = out + nDone;
+    for (int k = 0; k < nSeg; ++k) {
+      double uni = uI[-k] - uJ[-k];
+      uni += double(uni < 0.);
+      uI[-k] = uni;
+      uni -= cSeg[k];
+      uni += double(uni < 0.);
+      outSeg[k] = uni;
+    }
+    i97 -= nSeg;
+    j97 -= nSeg;
+    if (i97 < 0) i97 = 96;
+    if (j97 < 0) j97 = 96;
+
+    // Remove the (very rare) numbers at the edges, as done by flatStep.
+    int nAcc = nDone;
+    for (int k = 0; k < nSeg; ++k)
+      if (outSeg[k] > 0. && outSeg[k] < 1.) out[nAcc++] = outSeg[k];
+    nDone = nAcc;
+  }
+
+  // Store updated state.
+  stateSave.i97       = i97;
+  stateSave.j97       = j97;
+  stateSave.c         = c;
+  stateSave.sequence += n;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Step a state one random number forward, and return that number.
+
+double Rndm::flatStep(RndmState& state) {
+
+  // Find next random number and update state.
+  ++state.sequence;
   double uni;
   do {
-    uni = stateSave.u[stateSave.i97] - stateSave.u[stateSave.j97];
+    uni = state.u[state.i97] - state.u[state.j97];
     if (uni < 0.) uni += 1.;
-    stateSave.u[stateSave.i97] = uni;
-    if (--stateSave.i97 < 0) stateSave.i97 = 96;
-    if (--stateSave.j97 < 0) stateSave.j97 = 96;
-    stateSave.c -= stateSave.cd;
-    if (stateSave.c < 0.) stateSave.c += stateSave.cm;
-    uni -= stateSave.c;
+    state.u[state.i97] = uni;
+    if (--state.i97 < 0) state.i97 = 96;
+    if (--state.j97 < 0) state.j97 = 96;
+    state.c -= state.cd;
+    if (state.c < 0.) state.c += state.cm;
+    uni -= state.c;
     if(uni < 0.) uni += 1.;
    } while (uni <= 0. || uni >= 1.);
   return uni;
@@ -214,6 +333,72 @@ double Rndm::flat() {
 
 //--------------------------------------------------------------------------
 
+// Fill an array with n random numbers uniformly between 0 and 1.
+
+void Rndm::flatBatch(double* out, int n) {
+
+  // First hand out numbers already in the buffer.
+  int iOut = 0;
+  while (iOut < n && iBuffer < nBuffer) out[iOut++] = buffer[iBuffer++];
+  if (iOut == n) return;
+
+  // Use external random number generator if such has been linked.
+  if (useExternalRndm) {
+    while (iOut < n) out[iOut++] = rndmEngPtr->flat();
+    return;
+  }
+
+  // Generate the rest directly into the array.
+  if (!initRndm) init(DEFAULTSEED);
+  generate(out + iOut, n - iOut);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fill an array with n random numbers according to exp(-x).
+
+void Rndm::expBatch(double* out, int n) {
+
+  flatBatch(out, n);
+  for (int i = 0; i < n; ++i) out[i] = -log(out[i]);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fill an array with n random numbers according to exp(-x^2/2).
+// Uses two uniform numbers for each, first radius and then angle, as
+// gauss(). Done in chunks, to avoid allocating an intermediate array.
+
+void Rndm::gaussBatch(double* out, int n) {
+
+  double flats[NBUFFER];
+  for (int iStart = 0; iStart < n; iStart += NBUFFER / 2) {
+    int nNow = min( NBUFFER / 2, n - iStart);
+    flatBatch(flats, 2 * nNow);
+    for (int i = 0; i < nNow; ++i) out[iStart + i]
+      = sqrt(-2. * log(flats[2 * i])) * cos(M_PI * flats[2 * i + 1]);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Get the state of the random number generator, i.e. after the last
+// number handed out, rather than after the last number in the buffer.
+
+RndmState Rndm::getState() const {
+
+  if (iBuffer >= nBuffer) return stateSave;
+  RndmState state = stateBuffer;
+  for (int i = 0; i < iBuffer; ++i) flatStep(state);
+  return state;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Generate a random number according to a Gamma-distribution.
 
 double Rndm::gamma(double k0, double r0) {
@@ -271,6 +456,9 @@ pair<Vec4, Vec4> Rndm::phaseSpace2(double eCM, double m1, double m2) {
 
 bool Rndm::dumpState(string fileName) {
 
+  // Bring state up to date with the numbers handed out.
+  dropBuffer();
+
   // Open file as output stream.
   const char* fn = fileName.c_str();
   ofstream ofs(fn, ios::binary);
@@ -321,6 +509,8 @@ bool Rndm::readState(string fileName) {
   ifs.read((char *) &stateSave.cd,       sizeof(double));
   ifs.read((char *) &stateSave.cm,       sizeof(double));
   ifs.read((char *) &stateSave.u,        sizeof(double) *97);
+  initRndm = true;
+  iBuffer = nBuffer = 0;
 
   // Write confirmation on cout.
   cout << " PYTHIA Rndm::readState: seed " << stateSave.seed
@@ -2265,6 +2455,97 @@ Hist operator/(double f, const Hist& h1) {
 
 //==========================================================================
 
+// ParallelHist class.
+// A histogram that can be filled from several threads at the same time.
+
+//--------------------------------------------------------------------------
+
+// Constants: could be changed here if desired, but normally should not.
+
+// Maximum number of threads filling without locks at the same time.
+const int ParallelHist::NSHARDMAX = 256;
+
+//--------------------------------------------------------------------------
+
+// Sum of all shards, as an ordinary histogram.
+
+Hist ParallelHist::result() const {
+
+  lock_guard<mutex> lock(baseMutex);
+  Hist hSum(baseHist);
+  for (int i = 0; i < NSHARDMAX; ++i) {
+    Hist* hPtr = shards[i].load();
+    if (hPtr != nullptr) hSum += *hPtr;
+  }
+  return hSum;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Reset contents.
+
+void ParallelHist::null() {
+
+  lock_guard<mutex> lock(baseMutex);
+  baseHist.null();
+  for (int i = 0; i < NSHARDMAX; ++i) {
+    Hist* hPtr = shards[i].load();
+    if (hPtr != nullptr) hPtr->null();
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// The shard of the current thread. Only this thread writes to its slot,
+// so no compare-and-swap is needed when it is first created.
+
+Hist* ParallelHist::shard() {
+
+  int iShard = threadIndex();
+  if (iShard >= NSHARDMAX) return nullptr;
+  Hist* hPtr = shards[iShard].load();
+  if (hPtr == nullptr) {
+    lock_guard<mutex> lock(baseMutex);
+    hPtr = new Hist(baseHist.getTitle(), baseHist);
+    hPtr->null();
+    shards[iShard].store(hPtr);
+  }
+  return hPtr;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Small index of the current thread. Each live thread has its own index,
+// and an index is handed back when its thread ends, so that the indices
+// stay small even if many short-lived threads are created over a run.
+
+int ParallelHist::threadIndex() {
+
+  // Pool of indices shared by all threads.
+  static mutex poolMutex;
+  static vector<int> freeIndices;
+  static int nIndices = 0;
+
+  // Index of a thread, taken from the pool at the first call in the
+  // thread, and handed back when the thread ends.
+  struct ThreadIndex {
+    int index;
+    ThreadIndex() { lock_guard<mutex> lock(poolMutex);
+      if (freeIndices.empty()) index = nIndices++;
+      else { index = freeIndices.back(); freeIndices.pop_back(); } }
+    ~ThreadIndex() { lock_guard<mutex> lock(poolMutex);
+      freeIndices.push_back(index); }
+  };
+  static thread_local ThreadIndex threadIndexNow;
+  return threadIndexNow.index;
+
+}
+
+//==========================================================================
+
 // HistPlot class.
 // Writes a Python program that can generate PDF plots from Hist histograms.
 
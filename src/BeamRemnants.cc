@@ -130,20 +130,20 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
   oldSize = event.size();
 
   // Store event as it was before adding anything.
-  Event eventSave = event;
+  event.saveCheckpoint();
   BeamParticle beamAsave = (*beamAPtr);
   BeamParticle beamBsave = (*beamBPtr);
   PartonSystems partonSystemsSave = (*partonSystemsPtr);
 
   // Two different methods to add the beam remnants.
-  if (remnantMode == 0) {
-    if (!addOld(event)) return false;
-  } else
-    if (!addNew(event)) return false;
-  if (isDIS) return true;
+  bool hasRemnants = (remnantMode == 0) ? addOld(event) : addNew(event);
+  if (!hasRemnants || isDIS) {
+    event.clearCheckpoint();
+    return hasRemnants;
+  }
 
   // Store event before doing colour reconnections.
-  Event eventTmpSave = event;
+  event.saveCheckpoint();
   bool colCorrect = false;
   for (int i = 0; i < 10; ++i) {
     if (doReconnect && doDiffCR
@@ -152,7 +152,7 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
 
       // Check that the new colour structure is physical.
       if (!junctionSplitting.checkColours(event))
-        event = eventTmpSave;
+        event.restoreCheckpoint();
       else {
         colCorrect = true;
         break;
@@ -164,6 +164,7 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
       break;
     }
   }
+  event.clearCheckpoint();
 
   // Possibility to add vertex information to beam particles and remnants.
   if (doPartonVertex) for (int iBeam = 0; iBeam < 2; ++iBeam) {
@@ -178,7 +179,8 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
 
   // Restore event and return false if colour reconnection failed.
   if (!colCorrect) {
-    event = eventSave;
+    event.restoreCheckpoint();
+    event.clearCheckpoint();
     (*beamAPtr) = beamAsave;
     (*beamBPtr) = beamBsave;
     (*partonSystemsPtr) = partonSystemsSave;
@@ -188,6 +190,7 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
   }
 
   // Done.
+  event.clearCheckpoint();
   return true;
 }
 
@@ -266,8 +269,8 @@ bool BeamRemnants::addOld( Event& event) {
 
 bool BeamRemnants::addNew( Event& event) {
 
-   // Start by saving a copy of the event, if the beam remnant fails.
-  Event eventSave = event;
+   // Start by saving a checkpoint of the event, if the beam remnant fails.
+  event.saveCheckpoint();
   BeamParticle beamAsave = (*beamAPtr);
   BeamParticle beamBsave = (*beamBPtr);
   PartonSystems partonSystemsSave = (*partonSystemsPtr);
@@ -299,7 +302,8 @@ bool BeamRemnants::addNew( Event& event) {
     // Do the kinematics of the collision subsystems and two beam remnants.
     if (!setKinematics(event)) {
       // If it does not work, try parton level again.
-      event = eventSave;
+      event.restoreCheckpoint();
+      event.clearCheckpoint();
       (*beamAPtr) = beamAsave;
       (*beamBPtr) = beamBsave;
       (*partonSystemsPtr) = partonSystemsSave;
@@ -319,7 +323,7 @@ bool BeamRemnants::addNew( Event& event) {
     // If failed, restore earlier configuration and try to find new
     // colour structure.
     else {
-      event = eventSave;
+      event.restoreCheckpoint();
       (*beamAPtr) = beamAsave;
       (*beamBPtr) = beamBsave;
       (*partonSystemsPtr) = partonSystemsSave;
@@ -330,7 +334,8 @@ bool BeamRemnants::addNew( Event& event) {
   if (!beamRemnantFound) {
     loggerPtr->ERROR_MSG("failed to find physical colour structure");
     // Restore event to previous state.
-    event = eventSave;
+    event.restoreCheckpoint();
+    event.clearCheckpoint();
     (*beamAPtr) = beamAsave;
     (*beamBPtr) = beamBsave;
     (*partonSystemsPtr) = partonSystemsSave;
@@ -338,6 +343,7 @@ bool BeamRemnants::addNew( Event& event) {
   }
 
   // Done.
+  event.clearCheckpoint();
   return true;
 }
 
@@ -35,6 +35,10 @@ const double BoseEinstein::COMPRELERR = 1e-10;
 const double BoseEinstein::COMPFACMAX = 1000.;
 const int    BoseEinstein::NCOMPSTEP  = 10;
 
+// Safety margin in rapidity difference when only close pairs are searched,
+// to allow for hadrons with a mass slightly off the nominal one.
+const double BoseEinstein::YMARGIN    = 0.01;
+
 //--------------------------------------------------------------------------
 
 // Find settings. Precalculate table used to find momentum shifts.
@@ -50,6 +54,10 @@ bool BoseEinstein::init() {
   lambda   = parm("BoseEinstein:lambda");
   QRef     = parm("BoseEinstein:QRef");
 
+  // Optional upper limit on Q of pairs to be shifted.
+  QMaxPair  = parm("BoseEinstein:QMaxPair");
+  Q2MaxPair = QMaxPair * QMaxPair;
+
   // Multiples and inverses (= "radii") of distance parameters in Q-space.
   QRef2    = 2. * QRef;
   QRef3    = 3. * QRef;
@@ -138,9 +146,30 @@ bool BoseEinstein::shiftEvent( Event& event) {
     nStored[iSpecies + 1] = hadronBE.size();
 
     // Loop through pairs of identical particles and find shifts.
-    for (int i1 = nStored[iSpecies]; i1 < nStored[iSpecies+1] - 1; ++i1)
-    for (int i2 = i1 + 1; i2 < nStored[iSpecies+1]; ++i2)
-      shiftPair( i1, i2, iTab);
+    if (QMaxPair <= 0.) {
+      for (int i1 = nStored[iSpecies]; i1 < nStored[iSpecies+1] - 1; ++i1)
+      for (int i2 = i1 + 1; i2 < nStored[iSpecies+1]; ++i2)
+        shiftPair( i1, i2, iTab);
+
+    // Else only pairs below QMaxPair. For two hadrons of mass m
+    // m^2(p_1 + p_2) >= 2 m^2 (1 + cosh(y_1 - y_2)), which limits the
+    // rapidity difference, so search pairs in rapidity-ordered list.
+    // The pair shifts are then summed in rapidity order, not index order.
+    } else {
+      yOrder.resize(0);
+      for (int i = nStored[iSpecies]; i < nStored[iSpecies+1]; ++i)
+        yOrder.push_back( make_pair( hadronBE[i].p.rap(), i) );
+      sort( yOrder.begin(), yOrder.end() );
+      double m2Now    = pow2(mHadron[iSpecies]);
+      double yDiffMax = acosh( max( 1., 1. + (Q2MaxPair + m2Pair[iTab]
+        - 4. * m2Now) / (2. * m2Now) ) ) + YMARGIN;
+      int nNow = yOrder.size();
+      for (int j1 = 0; j1 < nNow - 1; ++j1)
+      for (int j2 = j1 + 1; j2 < nNow
+        && yOrder[j2].first - yOrder[j1].first < yDiffMax; ++j2)
+        shiftPair( min( yOrder[j1].second, yOrder[j2].second),
+          max( yOrder[j1].second, yOrder[j2].second), iTab);
+    }
   }
 
   // Must have at least two pairs to carry out compensation.
@@ -205,6 +234,7 @@ void BoseEinstein::shiftPair( int i1, int i2, int iTab) {
   // Calculate old relative momentum.
   double Q2old = m2(hadronBE[i1].p, hadronBE[i2].p) - m2Pair[iTab];
   if (Q2old < Q2MIN) return;
+  if (QMaxPair > 0. && Q2old > Q2MaxPair) return;
   double Qold  = sqrt(Q2old);
   double psFac = sqrt(Q2old + m2Pair[iTab]) / Q2old;
 
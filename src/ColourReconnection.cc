@@ -163,6 +163,13 @@ const double ColourReconnection::MINIMUMGAINJUN = 1E-10;
 // Require minimum squared invariant mass.
 const double ColourReconnection::TINYP1P2 = 1e-20;
 
+// Minimum squared dipole mass, relative to squared energy, for which the
+// rapidity difference to causally connected dipoles is limited.
+const double ColourReconnection::TINYM2DIP = 1e-8;
+
+// Safety margin on the maximal rapidity difference of such dipoles.
+const double ColourReconnection::DYMARGIN = 0.01;
+
 // Maximum number of reconnection per trial.
 // For very large number of outgoing partons, ie. if multiple pp collisions
 // are stacked on top of each other, this number is raised now. Tested for
@@ -171,10 +178,12 @@ const int ColourReconnection::MAXRECONNECTIONS = 10000;
 
 //--------------------------------------------------------------------------
 
-// Simple comparison function for sort.
+// Simple comparison function for the heaps of trials. Of two trials with
+// equal lambdaDiff, the one formed first is preferred.
 
 bool cmpTrials(const TrialReconnection& j1, const TrialReconnection& j2) {
-  return (j1.lambdaDiff < j2.lambdaDiff);}
+  return (j1.lambdaDiff < j2.lambdaDiff || (j1.lambdaDiff == j2.lambdaDiff
+    && j1.iOrder > j2.iOrder));}
 
 //--------------------------------------------------------------------------
 
@@ -210,6 +219,7 @@ bool ColourReconnection::init() {
   timeDilationParGeV  = timeDilationPar / HBARC;
   allowDiqJunCR       = flag("ColourReconnection:allowDiquarkJunctionCR");
   dipMaxDist          = parm("ColourReconnection:dipoleMaxDist")*FM2MM;
+  searchByRapidity    = flag("ColourReconnection:searchByRapidity");
 
   // Parameters of gluon-move model.
   m2Lambda            = parm("ColourReconnection:m2Lambda");
@@ -275,6 +285,8 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
   dipTrials.clear();
   formationTimes.clear();
   dipoleIndex = 0;
+  iUpdate     = 0;
+  nTrials     = 0;
 
   // Setup dipoles and make pseudo particles.
   setupDipoles(event, iFirst);
@@ -292,11 +304,17 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
     if (dipoles[i]->isActive)
       iDips[dipoles[i]->colReconnection].push_back(i);
 
-  // Loop over each colour individually.
+  // Loop over each colour individually. Only dipoles close enough in
+  // rapidity to be causally connected need to be paired.
+  orderDipoles(false);
+  vector<int> iNeighbours;
   for (int i = 0;i < int(iDips.size()); ++i)
-    for (int j = 0; j < int(iDips[i].size()); ++j)
-      for (int k = j + 1; k < int(iDips[i].size()); ++k)
-        singleReconnection(dipoles[iDips[i][j]], dipoles[iDips[i][k]]);
+    for (int j = 0; j < int(iDips[i].size()); ++j) {
+      findNeighbours(dipoles[iDips[i][j]], i, iDips[i][j], false,
+        iNeighbours);
+      for (int k = 0; k < int(iNeighbours.size()); ++k)
+        singleReconnection(dipoles[iDips[i][j]], dipoles[iNeighbours[k]]);
+    }
 
   // Only do warning once per event.
   bool alreadyWarned = false;
@@ -319,10 +337,10 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
 
       // Store all dipoles connected to the chosen dipole.
       usedDipoles.clear();
-      if (dipTrials.size()) storeUsedDips(dipTrials.back());
+      if (dipTrials.size()) storeUsedDips(dipTrials.front());
 
       // Do the reconnection.
-      if (dipTrials.size()) doDipoleTrial(dipTrials.back());
+      if (dipTrials.size()) doDipoleTrial(dipTrials.front());
 
       // Sort the used dipoles and remove copies of the same.
       sort(usedDipoles.begin(), usedDipoles.end());
@@ -333,6 +351,7 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
         }
 
       // Updating the dipole trials.
+      markUsedDips();
       updateDipoleTrials();
     }
 
@@ -351,22 +370,33 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
           iDips[dipoles[i]->colReconnection % 3].push_back(i);
 
       // Loop over different "colours" (now only three different groups).
+      // Again only dipoles that can be causally connected are combined.
+      orderDipoles(true);
       for (int i = 0;i < int(iDips.size()); ++i)
-        for (int j = 0; j < int(iDips[i].size()); ++j)
-          for (int k = j + 1; k < int(iDips[i].size()); ++k)
-            singleJunction(dipoles[iDips[i][j]], dipoles[iDips[i][k]]);
-
+        for (int j = 0; j < int(iDips[i].size()); ++j) {
+          findNeighbours(dipoles[iDips[i][j]], i, iDips[i][j], false,
+            iNeighbours);
+          for (int k = 0; k < int(iNeighbours.size()); ++k)
+            singleJunction(dipoles[iDips[i][j]], dipoles[iNeighbours[k]]);
+        }
 
       // Loop over different "colours" (now only three different groups).
       for (int i = 0;i < int(iDips.size()); ++i)
         for (int j = 0; j < int(iDips[i].size()); ++j) {
-          for (int k = j + 1; k < int(iDips[i].size()); ++k) {
-            for (int l = k + 1; l < int(iDips[i].size()); ++l)
-              singleJunction(dipoles[iDips[i][j]], dipoles[iDips[i][k]],
-                dipoles[iDips[i][l]]);
+          findNeighbours(dipoles[iDips[i][j]], i, iDips[i][j], true,
+            iNeighbours);
+          for (int k = 0; k < int(iNeighbours.size()); ++k) {
+            for (int l = k + 1; l < int(iNeighbours.size()); ++l)
+              if (nearInRapidity(dipoles[iNeighbours[k]],
+                dipoles[iNeighbours[l]], true))
+                singleJunction(dipoles[iDips[i][j]], dipoles[iNeighbours[k]],
+                  dipoles[iNeighbours[l]]);
           }
         }
 
+      // Trials left from an earlier round may contain used dipoles.
+      removeUsedTrials(junTrials);
+
       // Do inner loop for junction reconnections
       for (int iInnerLoop = 0;junTrials.size() > 0; ++iInnerLoop) {
 
@@ -381,11 +411,11 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
 
         // Find all dipoles connected to the reconnection.
         usedDipoles.clear();
-        if (junTrials.size()) storeUsedDips(junTrials.back());
+        if (junTrials.size()) storeUsedDips(junTrials.front());
 
         // Do the reconnection. Issue warning in case of failure.
         if (junTrials.size()) {
-          if (!doJunctionTrial(event, junTrials.back()))
+          if (!doJunctionTrial(event, junTrials.front()))
             loggerPtr->WARNING_MSG("junction reconnection failed");
         }
 
@@ -402,6 +432,7 @@ bool ColourReconnection::nextNew( Event& event, int iFirst) {
         }
 
         // Update lists.
+        markUsedDips();
         updateJunctionTrials();
         updateDipoleTrials();
 
@@ -930,6 +961,9 @@ double ColourReconnection::calculateDoubleJunctionLength( const int i,
 void ColourReconnection::singleReconnection(ColourDipolePtr& dip1,
       ColourDipolePtr& dip2) {
 
+  // Count the pairs of dipoles tried.
+  infoPtr->addCounter(32);
+
   // Do nothing if it is the same dipole.
   if (dip1 == dip2) return;
 
@@ -954,8 +988,7 @@ void ColourReconnection::singleReconnection(ColourDipolePtr& dip1,
   // Insert into trial reconnection if anything is gained.
   if (lambdaDiff > MINIMUMGAIN) {
     TrialReconnection dipTrial(dip1, dip2, 0, 0, 5, lambdaDiff);
-    dipTrials.insert(lower_bound(dipTrials.begin(), dipTrials.end(),
-         dipTrial, cmpTrials), dipTrial);
+    addTrial(dipTrials, dipTrial);
   }
 
 }
@@ -1022,6 +1055,9 @@ void ColourReconnection::swapDipoles(ColourDipolePtr& dip1,
 void ColourReconnection::singleJunction(ColourDipolePtr& dip1,
   ColourDipolePtr& dip2) {
 
+  // Count the combinations of dipoles tried.
+  infoPtr->addCounter(33);
+
    // Do nothing if it is the same dipole.
   if (dip1 == dip2)
     return;
@@ -1077,8 +1113,7 @@ void ColourReconnection::singleJunction(ColourDipolePtr& dip1,
   double lambdaDiff = getLambdaDiff(dip1, dip2, dip3, dip4, 0);
   if (lambdaDiff > MINIMUMGAINJUN) {
     TrialReconnection junTrial(dip1, dip2, dip3, dip4, 0, lambdaDiff);
-    junTrials.insert(lower_bound(junTrials.begin(), junTrials.end(),
-         junTrial, cmpTrials), junTrial);
+    addTrial(junTrials, junTrial);
   }
   // Outer loop
   while (true) {
@@ -1099,8 +1134,7 @@ void ColourReconnection::singleJunction(ColourDipolePtr& dip1,
         if (lambdaDiff > MINIMUMGAINJUN) {
 
           TrialReconnection junTrial(dip1, dip2, dip3, dip4, 1, lambdaDiff);
-          junTrials.insert(lower_bound(junTrials.begin(), junTrials.end(),
-             junTrial, cmpTrials), junTrial);
+          addTrial(junTrials, junTrial);
         }
       }
 
@@ -1130,8 +1164,7 @@ void ColourReconnection::singleJunction(ColourDipolePtr& dip1,
         if (lambdaDiff > MINIMUMGAINJUN) {
 
           TrialReconnection junTrial(dip1, dip2, dip3, dip4, 2, lambdaDiff);
-          junTrials.insert(lower_bound(junTrials.begin(), junTrials.end(),
-             junTrial, cmpTrials), junTrial);
+          addTrial(junTrials, junTrial);
         }
       }
 
@@ -1165,6 +1198,8 @@ void ColourReconnection::singleJunction(ColourDipolePtr& dip1,
 void ColourReconnection::singleJunction(const ColourDipolePtr& dip1,
   const ColourDipolePtr& dip2, const ColourDipolePtr& dip3) {
 
+  // Count the combinations of dipoles tried.
+  infoPtr->addCounter(33);
 
   if ( !(dip1->colReconnection != dip2->colReconnection
       && dip1->colReconnection != dip3->colReconnection
@@ -1202,8 +1237,7 @@ void ColourReconnection::singleJunction(const ColourDipolePtr& dip1,
   const double lambdaDiff = getLambdaDiff(dip1, dip2, dip3, nullptr, 3);
   if (lambdaDiff > MINIMUMGAINJUN) {
     TrialReconnection junTrial(dip1, dip2, dip3, nullptr, 3, lambdaDiff);
-    junTrials.insert(lower_bound(junTrials.begin(), junTrials.end(), junTrial,
-                                 cmpTrials), junTrial);
+    addTrial(junTrials, junTrial);
   }
 
   // Done.
@@ -2992,34 +3026,22 @@ void ColourReconnection::doDipoleTrial(TrialReconnection& trial) {
 
 void ColourReconnection::updateDipoleTrials() {
 
-  // Identify (and then erase) any junTrials that contain a used dipole.
-  vector<int> eraseTrials;
-  // Remove any dipTrials that contains a used dipole.
-  for (int i = 0; i < int(dipTrials.size()); ++i) {
-    for (int j = 0;j < 2; ++j) {
-      if (binary_search(usedDipoles.begin(), usedDipoles.end(),
-          dipTrials[i].dips[j]) ) {
-        eraseTrials.push_back(i);
-        break;
-      }
-    }
-  }
-  // Erase (stepping backwards to preserve indexing).
-  for (int iEra = int(eraseTrials.size()) - 1; iEra >= 0; --iEra) {
-    dipTrials.erase(dipTrials.begin() + eraseTrials[iEra]);
-  }
-
-  // Make list of active dipoles.
-  vector<ColourDipolePtr> activeDipoles;
-  for (int i = 0;i < int(dipoles.size()); ++i)
-    if (dipoles[i]->isActive)
-      activeDipoles.push_back(dipoles[i]);
+  // Order the active dipoles in rapidity.
+  orderDipoles(false);
 
-  // Loop over list of used dipoles and create new trial reconnections.
+  // Loop over list of used dipoles and create new trial reconnections
+  // with the active dipoles that can be causally connected to them.
+  vector<int> iNeighbours;
   for (int i = 0;i < int(usedDipoles.size()); ++i)
-    if (usedDipoles[i]->isActive)
-      for (int j = 0; j < int(activeDipoles.size()); ++j)
-        singleReconnection(usedDipoles[i], activeDipoles[j]);
+    if (usedDipoles[i]->isActive) {
+      findNeighbours(usedDipoles[i], usedDipoles[i]->colReconnection, -1,
+        false, iNeighbours);
+      for (int j = 0; j < int(iNeighbours.size()); ++j)
+        singleReconnection(usedDipoles[i], dipoles[iNeighbours[j]]);
+    }
+
+  // Remove any dipTrials on top that contain a used dipole.
+  removeUsedTrials(dipTrials);
 
 }
 
@@ -3029,53 +3051,221 @@ void ColourReconnection::updateDipoleTrials() {
 
 void ColourReconnection::updateJunctionTrials() {
 
-  // Identify (and then erase) any junTrials that contain a used dipole.
-  vector<int> eraseTrials;
-  for (int i = 0; i < int(junTrials.size()); ++i) {
-    for (int j = 0; j < 4; ++j) {
-      if (binary_search(usedDipoles.begin(), usedDipoles.end(),
-          junTrials[i].dips[j]) ) {
-        eraseTrials.push_back(i);
-        break;
-      }
-    }
-  }
-  // Erase (stepping backwards to preserve indexing).
-  for (int iEra = int(eraseTrials.size()) - 1; iEra >= 0; --iEra) {
-    junTrials.erase(junTrials.begin() + eraseTrials[iEra]);
-  }
-
-  // Make list of active dipoles.
-  vector<vector<ColourDipolePtr>> activeDipoles(3, vector<ColourDipolePtr>());
-  for (int i = 0;i < int(dipoles.size()); ++i)
-    if (dipoles[i]->isActive and !(dipoles[i]->isJun or dipoles[i]->isAntiJun))
-      activeDipoles[dipoles[i]->colReconnection%3].push_back(dipoles[i]);
+  // Order the active dipoles in rapidity, in three groups.
+  orderDipoles(true);
 
   // Loop over used dipoles and form new junction trials.
+  vector<int> iNeighbours;
   for (int i = 0;i < int(usedDipoles.size()); ++i) {
     if (!usedDipoles[i]->isActive) { continue; }
     if (usedDipoles[i]->isJun || usedDipoles[i]->isAntiJun) { continue; }
-      for (int j = 0; j < int(activeDipoles[usedDipoles[i]->
-            colReconnection%3].size()); ++j)
-        singleJunction(usedDipoles[i], activeDipoles[usedDipoles[i]->
-            colReconnection%3][j]);
+    findNeighbours(usedDipoles[i], usedDipoles[i]->colReconnection%3, -1,
+      false, iNeighbours);
+    for (int j = 0; j < int(iNeighbours.size()); ++j)
+      singleJunction(usedDipoles[i], dipoles[iNeighbours[j]]);
   }
 
   // Loop over used dipoles and form new junction trials.
   for (int i = 0;i < int(usedDipoles.size()); ++i) {
     if (!usedDipoles[i]->isActive) { continue; }
     if (usedDipoles[i]->isJun || usedDipoles[i]->isAntiJun) { continue; }
-    for (int j = 0; j < int(activeDipoles[usedDipoles[i]->
-          colReconnection%3].size()); ++j) {
-      for (int k = j + 1; k < int(activeDipoles[usedDipoles[i]->
-            colReconnection%3].size()); ++k) {
-        singleJunction(usedDipoles[i], activeDipoles[usedDipoles[i]->
-            colReconnection%3][j],
-          activeDipoles[usedDipoles[i]->colReconnection%3][k]);
+    findNeighbours(usedDipoles[i], usedDipoles[i]->colReconnection%3, -1,
+      true, iNeighbours);
+    for (int j = 0; j < int(iNeighbours.size()); ++j) {
+      for (int k = j + 1; k < int(iNeighbours.size()); ++k) {
+        if (nearInRapidity(dipoles[iNeighbours[j]], dipoles[iNeighbours[k]],
+          true)) singleJunction(usedDipoles[i], dipoles[iNeighbours[j]],
+          dipoles[iNeighbours[k]]);
       }
     }
   }
 
+  // Remove any junTrials on top that contain a used dipole.
+  removeUsedTrials(junTrials);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Add a trial reconnection to a heap of trials.
+
+void ColourReconnection::addTrial(vector<TrialReconnection>& trials,
+  TrialReconnection& trial) {
+
+  trial.iUpdate = iUpdate;
+  trial.iOrder  = ++nTrials;
+  trials.push_back(trial);
+  push_heap(trials.begin(), trials.end(), cmpTrials);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Mark the used dipoles with a new update number. Trials formed in an
+// earlier update that contain any of them are then no longer valid.
+
+void ColourReconnection::markUsedDips() {
+
+  ++iUpdate;
+  for (int i = 0; i < int(usedDipoles.size()); ++i)
+    usedDipoles[i]->iUsed = iUpdate;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Remove the trials containing used dipoles from the top of a heap, so
+// that the first trial is a valid one. Others are removed when on top.
+
+void ColourReconnection::removeUsedTrials(vector<TrialReconnection>& trials) {
+
+  while (trials.size() > 0) {
+    bool hasUsedDip = false;
+    for (int j = 0; j < int(trials.front().dips.size()); ++j)
+      if (trials.front().dips[j] != 0
+        && trials.front().dips[j]->iUsed > trials.front().iUpdate)
+        hasUsedDip = true;
+    if (!hasUsedDip) return;
+    pop_heap(trials.begin(), trials.end(), cmpTrials);
+    trials.pop_back();
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find the rapidity of a dipole, and the maximal rapidity difference to
+// dipoles it can be causally connected with. For two timelike momenta the
+// gamma factor of the time dilation check is at least cosh(y1 - y2), so
+// the maximal gamma factor allowed by the dipole limits the difference.
+
+void ColourReconnection::setDipoleRapidity(const ColourDipolePtr& dip)
+  const {
+
+  // Use cached values if the dipole ends are unchanged.
+  if (dip->yCalculated && dip->iCol == dip->yiCol
+    && dip->iAcol == dip->yiAcol) return;
+  dip->yCalculated = true;
+  dip->yiCol       = dip->iCol;
+  dip->yiAcol      = dip->iAcol;
+  dip->dyMaxDip    = -1.;
+
+  // No limit without time dilation check, or for dipoles connected to
+  // junctions, since their momenta can change with unchanged ends.
+  if (!searchByRapidity || timeDilationMode == 0 || dip->isJun
+    || dip->isAntiJun || dip->iCol < 0 || dip->iAcol < 0) return;
+
+  // No limit for (almost) massless dipoles, where the check is unstable.
+  Vec4 p = getDipoleMomentum(dip);
+  double m2 = p.m2Calc();
+  if (p.e() <= 0. || m2 < TINYM2DIP * pow2(p.e())) return;
+
+  // Maximal gamma factor allowed by the dipole.
+  double gammaMax = timeDilationPar;
+  if (timeDilationMode == 2 || timeDilationMode == 3)
+    gammaMax = timeDilationParGeV * sqrt(m2);
+  else if (timeDilationMode > 3) {
+    if (dip->col < 0 || dip->col >= int(formationTimes.size())) return;
+    gammaMax = timeDilationParGeV * formationTimes[dip->col];
+  }
+  dip->yDip     = p.rap();
+  dip->dyMaxDip = acosh(max(1., gammaMax)) + DYMARGIN;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Check whether two dipoles can be causally connected, given their
+// rapidities. For three dipoles, either all pairs of them or only one
+// pair need to be connected, depending on timeDilationMode.
+
+bool ColourReconnection::nearInRapidity(const ColourDipolePtr& dip1,
+  const ColourDipolePtr& dip2, bool forTriple) const {
+
+  if (dip1->dyMaxDip < 0. || dip2->dyMaxDip < 0.) return true;
+  bool onlyOnePair = (timeDilationMode == 3 || timeDilationMode == 5);
+  if (forTriple && onlyOnePair) return true;
+  double dy = abs(dip1->yDip - dip2->yDip);
+  return (onlyOnePair) ? dy <= max(dip1->dyMaxDip, dip2->dyMaxDip)
+                       : dy <= min(dip1->dyMaxDip, dip2->dyMaxDip);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Order the active dipoles of each reconnection colour in rapidity. For
+// junction formation only dipoles not connected to junctions are used,
+// and the colours are combined into three groups.
+
+void ColourReconnection::orderDipoles(bool forJunctions) {
+
+  // Reset lists.
+  int nGroup = (forJunctions) ? 3 : nReconCols;
+  yOrderDips.resize(nGroup);
+  iUnorderedDips.resize(nGroup);
+  dyMaxDips.assign(nGroup, 0.);
+  for (int iGroup = 0; iGroup < nGroup; ++iGroup) {
+    yOrderDips[iGroup].clear();
+    iUnorderedDips[iGroup].clear();
+  }
+
+  // Sort dipoles into groups, and order in rapidity where possible.
+  for (int i = 0; i < int(dipoles.size()); ++i) {
+    const ColourDipolePtr& dip = dipoles[i];
+    if (!dip->isActive) continue;
+    if (forJunctions && (dip->isJun || dip->isAntiJun)) continue;
+    int iGroup = (forJunctions) ? dip->colReconnection % 3
+               : dip->colReconnection;
+    setDipoleRapidity(dip);
+    if (dip->dyMaxDip < 0.) iUnorderedDips[iGroup].push_back(i);
+    else {
+      yOrderDips[iGroup].push_back( make_pair(dip->yDip, i) );
+      dyMaxDips[iGroup] = max( dyMaxDips[iGroup], dip->dyMaxDip);
+    }
+  }
+  for (int iGroup = 0; iGroup < nGroup; ++iGroup)
+    sort( yOrderDips[iGroup].begin(), yOrderDips[iGroup].end() );
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find the active dipoles of a group, at positions in dipoles after iAfter,
+// that can be causally connected with a given dipole, in increasing order.
+// For three dipoles, the check is instead whether a third one can be added.
+
+void ColourReconnection::findNeighbours(const ColourDipolePtr& dip,
+  int iGroup, int iAfter, bool forTriple, vector<int>& iNeighbours) {
+
+  // Dipoles without rapidity limit are always included.
+  iNeighbours.clear();
+  for (int i : iUnorderedDips[iGroup])
+    if (i > iAfter && dipoles[i] != dip) iNeighbours.push_back(i);
+
+  // Also all ordered ones if the given dipole does not have a limit.
+  const vector< pair<double,int> >& yOrder = yOrderDips[iGroup];
+  bool onlyOnePair = (timeDilationMode == 3 || timeDilationMode == 5);
+  setDipoleRapidity(dip);
+  if (dip->dyMaxDip < 0. || (forTriple && onlyOnePair)) {
+    for (int j = 0; j < int(yOrder.size()); ++j)
+      if (yOrder[j].second > iAfter && dipoles[yOrder[j].second] != dip)
+        iNeighbours.push_back(yOrder[j].second);
+
+  // Else only those inside the allowed rapidity range.
+  } else {
+    double dyMax = (onlyOnePair) ? max( dip->dyMaxDip, dyMaxDips[iGroup])
+                 : dip->dyMaxDip;
+    vector< pair<double,int> >::const_iterator it = lower_bound(
+      yOrder.begin(), yOrder.end(), make_pair(dip->yDip - dyMax, -1));
+    for ( ; it != yOrder.end() && it->first <= dip->yDip + dyMax; ++it)
+      if (it->second > iAfter && dipoles[it->second] != dip
+        && nearInRapidity(dip, dipoles[it->second]))
+        iNeighbours.push_back(it->second);
+  }
+
+  // Return in the order of the dipole list.
+  sort( iNeighbours.begin(), iNeighbours.end() );
+
 }
 
 //--------------------------------------------------------------------------
@@ -3604,23 +3604,23 @@ void DireHistory::attachClusterings (vector<DireClustering>& clus, int iEmt,
   } else {
 
     // Get ID of radiator before the splitting.
-    map<string,double> stateVars;
+    StateVariables stateVars;
     bool hasPartonLevel(showers && showers->timesPtr && showers->spacePtr),
          hasShowers(fsr && isr);
     if (hasPartonLevel) {
       bool isFSR = showers->timesPtr->isTimelike(event, iRad, iEmt, iRec, "");
-      if (isFSR) stateVars = showers->timesPtr->getStateVariables(event,iRad,
+      if (isFSR) stateVars = showers->timesPtr->stateVariables(event,iRad,
         iEmt,iRec,name);
-      else       stateVars = showers->spacePtr->getStateVariables(event,iRad,
+      else       stateVars = showers->spacePtr->stateVariables(event,iRad,
         iEmt,iRec,name);
     } else if (hasShowers) {
       bool isFSR = fsr->isTimelike(event, iRad, iEmt, iRec, "");
-      if (isFSR) stateVars = fsr->getStateVariables(event,iRad,iEmt,iRec,name);
-      else       stateVars = isr->getStateVariables(event,iRad,iEmt,iRec,name);
+      if (isFSR) stateVars = fsr->stateVariables(event,iRad,iEmt,iRec,name);
+      else       stateVars = isr->stateVariables(event,iRad,iEmt,iRec,name);
     }
 
     // Get flavour of radiator after potential clustering
-    int radBeforeFlav = int(stateVars["radBefID"]);
+    int radBeforeFlav = int(stateVars[StateVariables::RADBEFID]);
 
     clus.push_back( DireClustering(iEmt, iRad, iRec, iPartner, pT,
       &event[iRad], &event[iEmt], &event[iRec], name, radBeforeFlav, 0, 0, 0));
@@ -5358,7 +5358,7 @@ bool DireHistory::allowedClustering( int rad, int emt, int rec, int partner,
   int type       = (event[rad].isFinal()) ? 1 :-1;
 
   // Use external shower for merging.
-  map<string,double> stateVars;
+  StateVariables stateVars;
 
   if (name.compare("Dire_fsr_qcd_1->21&1") == 0) swap(rad,emt);
   if (name.compare("Dire_fsr_qcd_1->22&1") == 0) swap(rad,emt);
@@ -5368,27 +5368,27 @@ bool DireHistory::allowedClustering( int rad, int emt, int rec, int partner,
        hasShowers(fsr && isr);
   if (hasPartonLevel) {
     bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = showers->timesPtr->getStateVariables
+    if (isFSR) stateVars = showers->timesPtr->stateVariables
                  (event,rad,emt,rec,name);
-    else       stateVars = showers->spacePtr->getStateVariables
+    else       stateVars = showers->spacePtr->stateVariables
                  (event,rad,emt,rec,name);
   } else if (hasShowers) {
     bool isFSR = fsr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = fsr->getStateVariables(event,rad,emt,rec,name);
-    else       stateVars = isr->getStateVariables(event,rad,emt,rec,name);
+    if (isFSR) stateVars = fsr->stateVariables(event,rad,emt,rec,name);
+    else       stateVars = isr->stateVariables(event,rad,emt,rec,name);
   }
 
   // Get flavour of radiator after potential clustering
-  int radBeforeFlav = int(stateVars["radBefID"]);
+  int radBeforeFlav = int(stateVars[StateVariables::RADBEFID]);
   // Get colours of the radiator before the potential clustering
-  int radBeforeCol = int(stateVars["radBefCol"]);
-  int radBeforeAcl = int(stateVars["radBefAcol"]);
+  int radBeforeCol = int(stateVars[StateVariables::RADBEFCOL]);
+  int radBeforeAcl = int(stateVars[StateVariables::RADBEFACOL]);
 
   // Get colour partner of reclustered parton
   vector<int> radBeforeColP = getReclusteredPartners(rad, emt, event);
 
   // Only allow clustering if the evolution scale is well-defined.
-  if ( stateVars["t"] < 0.0) return false;
+  if ( stateVars[StateVariables::T] < 0.0) return false;
 
   // Count coloured partons in hard process
   int nPartonInHard = 0;
@@ -6544,24 +6544,24 @@ double DireHistory::pTLund(const Event& event, int rad, int emt, int rec,
   string name) {
 
   // Use external shower for merging.
-  map<string,double> stateVars;
+  StateVariables stateVars;
 
   bool hasPartonLevel(showers && showers->timesPtr && showers->spacePtr),
        hasShowers(fsr && isr);
   if (hasPartonLevel) {
     bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = showers->timesPtr->getStateVariables
+    if (isFSR) stateVars = showers->timesPtr->stateVariables
                  (event, rad,emt,rec, name);
-    else       stateVars = showers->spacePtr->getStateVariables
+    else       stateVars = showers->spacePtr->stateVariables
                  (event, rad,emt,rec, name);
   } else if (hasShowers) {
     bool isFSR = fsr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = fsr->getStateVariables(event, rad,emt,rec, name);
-    else       stateVars = isr->getStateVariables(event, rad,emt,rec, name);
+    if (isFSR) stateVars = fsr->stateVariables(event, rad,emt,rec, name);
+    else       stateVars = isr->stateVariables(event, rad,emt,rec, name);
   }
 
-  return ( (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-           ? sqrt(stateVars["t"]) : -1.0 );
+  return ( stateVars.has(StateVariables::T)
+           ? sqrt(stateVars[StateVariables::T]) : -1.0 );
 }
 
 //--------------------------------------------------------------------------
@@ -7211,7 +7211,7 @@ void DireHistory::setProbabilities() {
                               childNow->clusterIn.emt()->p());
 
       // Get clustering variables.
-      map<string,double> stateVars;
+      StateVariables stateVars;
       int rad = childNow->clusterIn.radPos();
       int emt = childNow->clusterIn.emtPos();
       int rec = childNow->clusterIn.recPos();
@@ -7221,21 +7221,21 @@ void DireHistory::setProbabilities() {
       if (hasPartonLevel) {
         isFSR = showers->timesPtr->isTimelike
           (sisterNow->state, rad, emt, rec, "");
-        if (isFSR) stateVars = showers->timesPtr->getStateVariables
+        if (isFSR) stateVars = showers->timesPtr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
-        else       stateVars = showers->spacePtr->getStateVariables
+        else       stateVars = showers->spacePtr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
       } else if (hasShowers) {
         isFSR = fsr->isTimelike(sisterNow->state, rad, emt, rec, "");
-        if (isFSR) stateVars = fsr->getStateVariables
+        if (isFSR) stateVars = fsr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
-        else       stateVars = isr->getStateVariables
+        else       stateVars = isr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
       }
 
-      double z   = stateVars["z"];
-      double t   = stateVars["t"];
-      double Q2  = stateVars["m2dip"];
+      double z   = stateVars[StateVariables::Z];
+      double t   = stateVars[StateVariables::T];
+      double Q2  = stateVars[StateVariables::M2DIP];
       double xCS = 1.;
       // For splittings with initial-state particles, remember initial
       // momentum rescaling.
@@ -7362,7 +7362,7 @@ void DireHistory::setEffectiveScales() {
       double virtuality = massSign*(childNow->clusterIn.rad()->p()
                          + massSign*childNow->clusterIn.emt()->p()).m2Calc();
       // Get clustering variables.
-      map<string,double> stateVars;
+      StateVariables stateVars;
       int rad = childNow->clusterIn.radPos();
       int emt = childNow->clusterIn.emtPos();
       int rec = childNow->clusterIn.recPos();
@@ -7371,20 +7371,20 @@ void DireHistory::setEffectiveScales() {
       if (hasPartonLevel) {
         isFSR = showers->timesPtr->isTimelike
           (sisterNow->state, rad, emt, rec, "");
-        if (isFSR) stateVars = showers->timesPtr->getStateVariables
+        if (isFSR) stateVars = showers->timesPtr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
-        else       stateVars = showers->spacePtr->getStateVariables
+        else       stateVars = showers->spacePtr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
       } else if (hasShowers) {
         isFSR = fsr->isTimelike(sisterNow->state, rad, emt, rec, "");
-        if (isFSR) stateVars = fsr->getStateVariables
+        if (isFSR) stateVars = fsr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
-        else       stateVars = isr->getStateVariables
+        else       stateVars = isr->stateVariables
                      (sisterNow->state,rad,emt,rec,"");
       }
 
-      double z   = stateVars["z"];
-      double Q2  = stateVars["m2dip"];
+      double z   = stateVars[StateVariables::Z];
+      double Q2  = stateVars[StateVariables::M2DIP];
       double xCS = 1.;
       // For splittings with initial-state particles, remember initial
       // momentum rescaling.
@@ -7401,7 +7401,7 @@ void DireHistory::setEffectiveScales() {
       // Construct coupling.
       double coupling(1.);
       string name  = childNow->clusterIn.name();
-      int idRadBef = int(stateVars["radBefID"]);
+      int idRadBef = int(stateVars[StateVariables::RADBEFID]);
       int idRec    = sisterNow->state[rec].id();
       if (hasPartonLevel) {
         if      ( name.find("qcd") != string::npos)
@@ -7497,23 +7497,22 @@ void DireHistory::setEffectiveScales() {
 double DireHistory::getShowerPluginScale(const Event& event, int rad, int emt,
   int rec, string name, string key, double) {
 
-  map<string,double> stateVars;
+  StateVariables stateVars;
   bool hasPartonLevel(showers && showers->timesPtr && showers->spacePtr),
        hasShowers(fsr && isr);
   if (hasPartonLevel) {
     bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = showers->timesPtr->getStateVariables
+    if (isFSR) stateVars = showers->timesPtr->stateVariables
                  (event, rad, emt, rec, name);
-    else       stateVars = showers->spacePtr->getStateVariables
+    else       stateVars = showers->spacePtr->stateVariables
                  (event, rad, emt, rec, name);
   } else if (hasShowers) {
     bool isFSR = fsr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = fsr->getStateVariables(event, rad, emt, rec, name);
-    else       stateVars = isr->getStateVariables(event, rad, emt, rec, name);
+    if (isFSR) stateVars = fsr->stateVariables(event, rad, emt, rec, name);
+    else       stateVars = isr->stateVariables(event, rad, emt, rec, name);
   }
 
-  return ( (stateVars.size() > 0 && stateVars.find(key) != stateVars.end())
-           ? stateVars[key] : -1.0 );
+  return stateVars.get(key);
 
 }
 
@@ -7525,29 +7524,27 @@ pair<int,double> DireHistory::getCoupling(const Event& event, int rad, int emt,
   int rec, string name) {
 
   // Retrieve state variables.
-  map<string,double> stateVars;
+  StateVariables stateVars;
   bool hasPartonLevel(showers && showers->timesPtr && showers->spacePtr),
        hasShowers(fsr && isr);
   if (hasPartonLevel) {
     bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = showers->timesPtr->getStateVariables
+    if (isFSR) stateVars = showers->timesPtr->stateVariables
                  (event, rad, emt, rec, name);
-    else       stateVars = showers->spacePtr->getStateVariables
+    else       stateVars = showers->spacePtr->stateVariables
                  (event, rad, emt, rec, name);
   } else if (hasShowers) {
     bool isFSR = fsr->isTimelike(event, rad, emt, rec, "");
-    if (isFSR) stateVars = fsr->getStateVariables(event, rad, emt, rec, name);
-    else       stateVars = isr->getStateVariables(event, rad, emt, rec, name);
+    if (isFSR) stateVars = fsr->stateVariables(event, rad, emt, rec, name);
+    else       stateVars = isr->stateVariables(event, rad, emt, rec, name);
   }
 
   // Get coupling type (identifier of interaction), and get coupling value for
   // the current splitting, i.e. 1 / [4\pi] * g^2 {splitting variables}
-  int type     = ( (stateVars.size() > 0
-                 && stateVars.find("couplingType") != stateVars.end())
-               ?  stateVars["couplingType"] : -1);
-  double value = ( (stateVars.size() > 0
-                 && stateVars.find("couplingValue") != stateVars.end())
-               ?  stateVars["couplingValue"] : -1.0);
+  int type     = ( stateVars.has(StateVariables::COUPLINGTYPE)
+               ?  stateVars[StateVariables::COUPLINGTYPE] : -1);
+  double value = ( stateVars.has(StateVariables::COUPLINGVALUE)
+               ?  stateVars[StateVariables::COUPLINGVALUE] : -1.0);
 
   // Done.
   return make_pair(type,value);
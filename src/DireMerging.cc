@@ -1731,7 +1731,7 @@ bool DireMerging::calculateSubtractions() {
     prob *= 2.;
 
     // Get clustering variables.
-    map<string,double> stateVars;
+    StateVariables stateVars;
     int rad = myHistory->children[i]->clusterIn.radPos();
     int emt = myHistory->children[i]->clusterIn.emtPos();
     int rec = myHistory->children[i]->clusterIn.recPos();
@@ -1739,14 +1739,14 @@ bool DireMerging::calculateSubtractions() {
     bool isFSR = myHistory->showers->timesPtr->isTimelike(myHistory->state,
       rad, emt, rec, "");
     if (isFSR)
-      stateVars = myHistory->showers->timesPtr->getStateVariables(
+      stateVars = myHistory->showers->timesPtr->stateVariables(
         myHistory->state,rad,emt,rec,"");
     else
-      stateVars = myHistory->showers->spacePtr->getStateVariables(
+      stateVars = myHistory->showers->spacePtr->stateVariables(
         myHistory->state,rad,emt,rec,"");
 
-    double z = stateVars["z"];
-    double t = stateVars["t"];
+    double z = stateVars[StateVariables::Z];
+    double t = stateVars[StateVariables::T];
 
     double m2dip = abs
       (-2.*myHistory->state[emt].p()*myHistory->state[rad].p()
@@ -2415,29 +2415,29 @@ double DireMergingHooks::rhoPythia(const Event& event, int rad, int emt,
 
   // Use external shower for merging.
   // Ask showers for evolution variable.
-  map<string,double> stateVars;
+  StateVariables stateVars;
   double ptret = event[0].m();
   bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
   if (isFSR) {
     vector<string> name = showers->timesPtr->getSplittingName
       (event, rad, emt, rec);
     for (int i=0; i < int(name.size()); ++i) {
-      stateVars = showers->timesPtr->getStateVariables
+      stateVars = showers->timesPtr->stateVariables
         (event, rad, emt, rec, name[i]);
       double pttemp = ptret;
-      if (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-        pttemp = sqrt(stateVars["t"]);
+      if (stateVars.has(StateVariables::T))
+        pttemp = sqrt(stateVars[StateVariables::T]);
       ptret = min(ptret,pttemp);
     }
   } else {
     vector<string> name = showers->spacePtr->getSplittingName
       (event, rad, emt, rec);
     for (int i=0; i < int(name.size()); ++i) {
-      stateVars = showers->spacePtr->getStateVariables
+      stateVars = showers->spacePtr->stateVariables
         (event, rad, emt, rec, name[i]);
       double pttemp = ptret;
-      if (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-        pttemp = sqrt(stateVars["t"]);
+      if (stateVars.has(StateVariables::T))
+        pttemp = sqrt(stateVars[StateVariables::T]);
       ptret = min(ptret,pttemp);
     }
   }
@@ -7040,64 +7040,77 @@ double DireSpace::m2dip_IF ( const Particle& rad, const Particle& emt,
 
 map<string, double> DireSpace::getStateVariables (const Event& state,
   int rad, int emt, int rec, string name) {
-  map<string,double> ret;
+  StateVariables vars = stateVariables( state, rad, emt, rec, name);
+  map<string,double> ret = vars.toMap();
+  ret.insert(make_pair("scaleForCoupling "
+    + std::to_string(int(vars[StateVariables::COUPLINGTYPE])),
+    vars[StateVariables::T]));
+  return ret;
+}
+
+//-------------------------------------------------------------------------
+
+// Return the evolution variable and splitting information in a fixed
+// layout. See header for more comments.
+
+StateVariables DireSpace::stateVariables (const Event& state,
+  int rad, int emt, int rec, const string& name) {
+  StateVariables ret;
 
   // State variables for a shower splitting (radBef,recBef) --> (rad,emt,rec)
   if (rad > 0 && emt > 0 && rec > 0) {
     double pT2 = pT2Space ( state[rad], state[emt], state[rec]);
     double z   = zSpace ( state[rad], state[emt], state[rec]);
-    ret.insert(make_pair("t",pT2));
-    ret.insert(make_pair("tRS",pT2));
-    ret.insert(make_pair("scaleAS",pT2));
-    ret.insert(make_pair("scaleEM",pT2));
-    ret.insert(make_pair("scalePDF",pT2));
-    ret.insert(make_pair("z",z));
+    ret.set(StateVariables::T, pT2);
+    ret.set(StateVariables::TRS, pT2);
+    ret.set(StateVariables::SCALEAS, pT2);
+    ret.set(StateVariables::SCALEEM, pT2);
+    ret.set(StateVariables::SCALEPDF, pT2);
+    ret.set(StateVariables::Z, z);
 
     // Book-keeping for particle before emission.
+    DireSplitting* split = (name != "") ? (*splittingsPtr)[name] : nullptr;
     int radBefID
-       = (name != "")
-       ? (*splittingsPtr)[name]->radBefID(state[rad].id(), state[emt].id())
+       = (split)
+       ? split->radBefID(state[rad].id(), state[emt].id())
        : 0;
     pair<int,int> radBefCols
-       = (name != "")
-       ? (*splittingsPtr)[name]->radBefCols(state[rad].col(),
+       = (split)
+       ? split->radBefCols(state[rad].col(),
              state[rad].acol(), state[emt].col(), state[emt].acol())
        : make_pair(0,0);
-    ret.insert(make_pair("radBefID", radBefID));
-    ret.insert(make_pair("radBefCol", radBefCols.first));
-    ret.insert(make_pair("radBefAcol", radBefCols.second));
+    ret.set(StateVariables::RADBEFID, radBefID);
+    ret.set(StateVariables::RADBEFCOL, radBefCols.first);
+    ret.set(StateVariables::RADBEFACOL, radBefCols.second);
 
     int couplingType
-       = (name != "")
-       ? (*splittingsPtr)[name]->couplingType(state[rad].id(), state[emt].id())
+       = (split)
+       ? split->couplingType(state[rad].id(), state[emt].id())
        : -1;
     double couplingValue
-       = (name != "")
-       ? (*splittingsPtr)[name]->coupling(z,pT2)
+       = (split)
+       ? split->coupling(z,pT2)
        : -1.0;
-    ret.insert(make_pair
-               ("scaleForCoupling " + std::to_string(couplingType), pT2));
-    ret.insert(make_pair("couplingType",couplingType));
-    ret.insert(make_pair("couplingValue",couplingValue));
+    ret.set(StateVariables::COUPLINGTYPE, couplingType);
+    ret.set(StateVariables::COUPLINGVALUE, couplingValue);
 
     double m2dip = m2dipSpace ( state[rad], state[emt], state[rec]);
-    ret.insert(make_pair("m2dip", m2dip));
+    ret.set(StateVariables::M2DIP, m2dip);
 
   // Variables defining the PS starting scales.
   } else {
 
     // In this case, insert only dummy information except for PDF scale.
-    ret.insert(make_pair("t",0.));
-    ret.insert(make_pair("tRS",0.));
-    ret.insert(make_pair("scaleAS",0.));
-    ret.insert(make_pair("scaleEM",0.));
-    ret.insert(make_pair("z",0.));
-    ret.insert(make_pair("radBefID", 0));
-    ret.insert(make_pair("radBefCol", 0));
-    ret.insert(make_pair("radBefAcol", 0));
-    ret.insert(make_pair("scaleForCoupling "+std::to_string(-1),0.));
-    ret.insert(make_pair("couplingType",-1));
-    ret.insert(make_pair("couplingValue",-1.));
+    ret.set(StateVariables::T, 0.);
+    ret.set(StateVariables::TRS, 0.);
+    ret.set(StateVariables::SCALEAS, 0.);
+    ret.set(StateVariables::SCALEEM, 0.);
+    ret.set(StateVariables::Z, 0.);
+    ret.set(StateVariables::RADBEFID, 0);
+    ret.set(StateVariables::RADBEFCOL, 0);
+    ret.set(StateVariables::RADBEFACOL, 0);
+    ret.set(StateVariables::COUPLINGTYPE, -1);
+    ret.set(StateVariables::COUPLINGVALUE, -1.);
 
     // Find the shower starting scale.
     // Find positions of incoming colliding partons.
@@ -7136,7 +7149,7 @@ map<string, double> DireSpace::getStateVariables (const Event& state,
       oss.str("");
       oss << "scalePDF-" << dipEnds[iDip].iRadiator
            << "-"        << dipEnds[iDip].iRecoiler;
-      ret.insert(make_pair(oss.str(),m2));
+      ret.extra.insert(make_pair(oss.str(),m2));
     }
   }
 
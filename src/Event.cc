@@ -27,11 +27,14 @@ const double Particle::TINY = 1e-20;
 
 // Set pointer to the particle data species of the particle.
 
-void Particle::setPDEPtr(ParticleDataEntryPtr pdePtrIn) {
+void Particle::setPDEPtr(ParticleDataEntry* pdePtrIn) {
   if (pdePtrIn || evtPtr == nullptr)
     pdePtr = pdePtrIn;
-  else if (evtPtr && evtPtr->particleDataPtr)
-    pdePtr = evtPtr->particleDataPtr->particleDataEntryPtr( idSave);}
+  else if (evtPtr && evtPtr->particleDataPtr) {
+    pdePtr = evtPtr->particleDataPtr->findEntry( idSave);
+    if (pdePtr == nullptr) pdePtr = evtPtr->particleDataPtr->findEntry(0);
+  }
+}
 
 //--------------------------------------------------------------------------
 
@@ -506,6 +509,7 @@ bool Particle::undoDecay() {
   }
 
   // Update mother that has been undecayed.
+  logChange();
   statusSave = abs(statusSave);
   daughter1Save = 0;
   daughter2Save = 0;
@@ -576,6 +580,7 @@ void Particle::offsetHistory( int minMother, int addMother, int minDaughter,
   int addDaughter) {
 
   if (addMother < 0 || addDaughter < 0) return;
+  logChange();
   if (  mother1Save > minMother  )   mother1Save += addMother;
   if (  mother2Save > minMother  )   mother2Save += addMother;
   if (daughter1Save > minDaughter) daughter1Save += addDaughter;
@@ -590,6 +595,7 @@ void Particle::offsetHistory( int minMother, int addMother, int minDaughter,
 void Particle::offsetCol( int addCol) {
 
   if (addCol < 0) return;
+  logChange();
   if ( colSave > 0)  colSave += addCol;
   if (acolSave > 0) acolSave += addCol;
 
@@ -687,6 +693,7 @@ int Event::copy(int iCopy, int newStatus) {
   if (iCopy < 0 || iCopy >= size()) return -1;
 
   // Simple carbon copy.
+  touch(iCopy);
   entry.push_back(entry[iCopy]);
   int iNew = entry.size() - 1;
 
@@ -719,6 +726,7 @@ void Event::remove(int iFirst, int iLast, bool shiftHistory) {
   // Check that removal range is sensible.
   if (iFirst < 0 || iLast >= int(entry.size()) || iLast < iFirst) return;
   int nRem = iLast + 1 - iFirst;
+  touchAll();
 
   // Remove the entries.
   entry.erase( entry.begin() + iFirst, entry.begin() + iLast + 1);
@@ -750,6 +758,122 @@ void Event::remove(int iFirst, int iLast, bool shiftHistory) {
 
 //--------------------------------------------------------------------------
 
+// Save a checkpoint of the event record. Only sizes, scalars and the short
+// lists of junctions and HV colours are copied right away.
+
+void Event::saveCheckpoint() {
+
+  // Reuse a previously allocated checkpoint if possible.
+  if (int(checkpoints.size()) <= nCheckpoint)
+    checkpoints.push_back( Checkpoint() );
+  Checkpoint& cp = checkpoints[nCheckpoint];
+
+  // Store current state.
+  cp.size                 = size();
+  cp.maxColTag            = maxColTag;
+  cp.savedSize            = savedSize;
+  cp.savedJunctionSize    = savedJunctionSize;
+  cp.savedHVcolsSize      = savedHVcolsSize;
+  cp.savedPartonLevelSize = savedPartonLevelSize;
+  cp.iEventHV             = iEventHV;
+  cp.iIndexHV             = iIndexHV;
+  cp.sizeUndoLog          = undoLog.size();
+  cp.scaleSave            = scaleSave;
+  cp.scaleSecondSave      = scaleSecondSave;
+  cp.junction             = junction;
+  cp.hvCols               = hvCols;
+  cp.stringBreaks         = stringBreaks;
+
+  // Entries up to current size are logged when first accessed.
+  ++nCheckpoint;
+  sizeCheckpointNow = size();
+  if (int(undoLevel.size()) < sizeCheckpointNow)
+    undoLevel.resize( sizeCheckpointNow, 0);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Restore the event record to the latest checkpoint, by undoing the
+// logged changes in reverse order. The checkpoint is kept.
+
+void Event::restoreCheckpoint() {
+
+  if (nCheckpoint == 0) return;
+  Checkpoint& cp = checkpoints[nCheckpoint - 1];
+
+  // Entries removed since the checkpoint have been logged as well.
+  // Logging is switched off while the old entries are copied back.
+  if (size() < cp.size) entry.resize( cp.size);
+  sizeCheckpointNow = 0;
+  for (int j = int(undoLog.size()) - 1; j >= cp.sizeUndoLog; --j) {
+    entry[undoLog[j].i]     = undoLog[j].entryOld;
+    undoLevel[undoLog[j].i] = undoLog[j].levelOld;
+  }
+  sizeCheckpointNow = cp.size;
+  undoLog.resize( cp.sizeUndoLog);
+  entry.resize( cp.size);
+
+  // Restore other properties.
+  maxColTag            = cp.maxColTag;
+  savedSize            = cp.savedSize;
+  savedJunctionSize    = cp.savedJunctionSize;
+  savedHVcolsSize      = cp.savedHVcolsSize;
+  savedPartonLevelSize = cp.savedPartonLevelSize;
+  iEventHV             = cp.iEventHV;
+  iIndexHV             = cp.iIndexHV;
+  scaleSave            = cp.scaleSave;
+  scaleSecondSave      = cp.scaleSecondSave;
+  junction             = cp.junction;
+  hvCols               = cp.hvCols;
+  stringBreaks         = cp.stringBreaks;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Drop the latest checkpoint but keep the changes made since. Logged
+// entries are handed on to an enclosing checkpoint, unless it already
+// has its own copy or the entry did not exist at that point.
+
+void Event::clearCheckpoint() {
+
+  if (nCheckpoint == 0) return;
+  int sizeUndoLog = checkpoints[--nCheckpoint].sizeUndoLog;
+  sizeCheckpointNow = (nCheckpoint > 0) ? checkpoints[nCheckpoint - 1].size
+    : 0;
+
+  // Compact the undo log.
+  int nKeep = sizeUndoLog;
+  for (int j = sizeUndoLog; j < int(undoLog.size()); ++j) {
+    int i = undoLog[j].i;
+    if (undoLog[j].levelOld < nCheckpoint && i < sizeCheckpointNow) {
+      undoLevel[i] = nCheckpoint;
+      if (j != nKeep) undoLog[nKeep] = undoLog[j];
+      ++nKeep;
+    } else undoLevel[i] = undoLog[j].levelOld;
+  }
+  undoLog.resize( nKeep);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Copy an entry to the undo log, before it is modified.
+
+void Event::logEntry(int i) {
+
+  if (i >= size()) return;
+  undoLog.push_back( UndoEntry() );
+  undoLog.back().i        = i;
+  undoLog.back().levelOld = undoLevel[i];
+  undoLog.back().entryOld = entry[i];
+  undoLevel[i]            = nCheckpoint;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Print an event.
 
 void Event::list(bool showScaleAndVertex, bool showMothersAndDaughters,
@@ -921,6 +1045,7 @@ Event& Event::operator+=( const Event& addEvent) {
   int offsetCol = maxColTag;
 
   // Add energy to zeroth line and calculate new invariant mass.
+  touch(0);
   entry[0].p( entry[0].p() + addEvent[0].p() );
   entry[0].m( entry[0].mCalc() );
 
@@ -979,4 +1104,51 @@ Event& Event::operator+=( const Event& addEvent) {
 
 //==========================================================================
 
+// EventColumns class.
+// This class holds a columnar copy of the main particle properties.
+
+//--------------------------------------------------------------------------
+
+// Fill the arrays from an event.
+
+void EventColumns::fill(const Event& event) {
+
+  // Resize arrays; capacity is kept from previous events.
+  nSave = event.size();
+  px.resize(nSave);
+  py.resize(nSave);
+  pz.resize(nSave);
+  e.resize(nSave);
+  m.resize(nSave);
+  id.resize(nSave);
+  status.resize(nSave);
+  mother1.resize(nSave);
+  mother2.resize(nSave);
+  daughter1.resize(nSave);
+  daughter2.resize(nSave);
+  chargeType.resize(nSave);
+  visible.resize(nSave);
+
+  // Copy properties, one particle at a time.
+  for (int i = 0; i < nSave; ++i) {
+    const Particle& pNow = event[i];
+    px[i]         = pNow.px();
+    py[i]         = pNow.py();
+    pz[i]         = pNow.pz();
+    e[i]          = pNow.e();
+    m[i]          = pNow.m();
+    id[i]         = pNow.id();
+    status[i]     = pNow.status();
+    mother1[i]    = pNow.mother1();
+    mother2[i]    = pNow.mother2();
+    daughter1[i]  = pNow.daughter1();
+    daughter2[i]  = pNow.daughter2();
+    chargeType[i] = pNow.chargeType();
+    visible[i]    = pNow.isVisible() ? 1 : 0;
+  }
+
+}
+
+//==========================================================================
+
 } // end namespace Pythia8
@@ -900,7 +900,7 @@ FlavContainer StringFlav::pickThermal(FlavContainer& flavOld,
   for (int iHad = 0; iHad < nPossHads; iHad++) {
     int hadronID = possibleHadronsNow[iHad].first;
     // Pick mass and calculate suppression factor.
-    double mass  = particleDataPtr->mSel(hadronID);
+    double mass  = particleDataPtr->mSel(hadronID, rndmPtr);
     possibleHadronMasses.push_back(mass);
     double rate  = exp( -sqrt(pow2(pT)+pow2(mass))/temprNow );
     // mT2 suppression with Gaussian pT?
@@ -1217,7 +1217,7 @@ int StringFlav::combineLastThermal(FlavContainer& flav1, FlavContainer& flav2,
   for (int iHad = 0; iHad < nPossHads; iHad++) {
     int hadronID = possibleHadronsNow[iHad].first;
     // Pick mass and calculate suppression factor.
-    double mass = particleDataPtr->mSel(hadronID);
+    double mass = particleDataPtr->mSel(hadronID, rndmPtr);
     possibleHadronMasses.push_back(mass);
     double rate = exp( -sqrt(pow2(pT)+pow2(mass))/temprNow );
     // mT2 suppression with Gaussian pT?
@@ -1508,6 +1508,146 @@ void StringFlav::variations(int idIn, bool early, bool noChoice) {
 
 //==========================================================================
 
+// The LundZTable class.
+
+//--------------------------------------------------------------------------
+
+// Set up the table for given a and c, in a range of b values.
+
+void LundZTable::init(double aIn, double cIn, int nBIn, int nZIn,
+  double bMin, double bMax) {
+
+  // Shape parameters and grid in ln(b).
+  aSave   = aIn;
+  cSave   = cIn;
+  nB      = max( 2, nBIn);
+  nZ      = max( 2, nZIn);
+  logBMin = log(bMin);
+  logBMax = log(bMax);
+  dLogB   = (logBMax - logBMin) / (nB - 1);
+  bNode.resize( nB);
+  logFNorm.resize( nB);
+  normUpp.resize( nB);
+  fMaxBin.resize( nB * nZ);
+  fCumBin.resize( nB * nZ);
+  iGuide.resize( nB * nZ);
+
+  // Loop over nodes. The function is sampled in u = sqrt(z), to have
+  // finer bins at small z, and as f(u) = 2 u f(z) = 2 z^(1/2) f(z) it
+  // is of the same form with c -> c - 1/2. Position of its maximum,
+  // unique in (0, 1), from (c - a) * z^2 - (b + c) * z + b = 0.
+  double cU = cSave - 0.5;
+  for (int iB = 0; iB < nB; ++iB) {
+    double b = exp( logBMin + iB * dLogB);
+    bNode[iB] = b;
+    double zPeak = (abs(cU - aSave) < 1e-6) ? b / (b + cU)
+      : 0.5 * (b + cU - sqrt( pow2(b + cU) - 4. * (cU - aSave) * b))
+      / (cU - aSave);
+    double uPeak = sqrt( min( 1., max( 0., zPeak)));
+
+    // Maximum in each bin is at the peak or at either edge.
+    vector<double> logFBin( nZ);
+    double logFMax = -1e300;
+    for (int iZ = 0; iZ < nZ; ++iZ) {
+      double uLow = double(iZ) / nZ;
+      double uUpp = double(iZ + 1) / nZ;
+      double logFNow = max( logF( uLow, b), logF( uUpp, b));
+      if (uPeak > uLow && uPeak < uUpp) logFNow = logF( uPeak, b);
+      logFBin[iZ] = logFNow;
+      logFMax = max( logFMax, logFNow);
+    }
+
+    // Store maxima normalized to the overall one, and cumulative sums.
+    logFNorm[iB] = logFMax;
+    double fSum  = 0.;
+    for (int iZ = 0; iZ < nZ; ++iZ) {
+      double fNow = exp( max( -700., logFBin[iZ] - logFMax));
+      fMaxBin[iB * nZ + iZ] = fNow;
+      fSum += fNow;
+      fCumBin[iB * nZ + iZ] = fSum;
+    }
+
+    // Guide table, to start the bin search close to the answer.
+    int iZ = 0;
+    for (int iSlice = 0; iSlice < nZ; ++iSlice) {
+      double fSlice = fSum * iSlice / nZ;
+      while (iZ < nZ - 1 && fCumBin[iB * nZ + iZ] <= fSlice) ++iZ;
+      iGuide[iB * nZ + iSlice] = iZ;
+    }
+  }
+
+  // Ratio of normalizations to the next node.
+  for (int iB = 0; iB < nB - 1; ++iB)
+    normUpp[iB] = exp( logFNorm[iB + 1] - logFNorm[iB]);
+  normUpp[nB - 1] = 1.;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Pick a z value for a b value inside the tabulated range. Since ln f is
+// linear in b, f at b between two nodes is a geometric mean of f at the
+// nodes, and thus below the arithmetic one. So a node is picked with
+// its share of the latter, then a bin in it, and z is accepted by the
+// ratio of f to the weighted sum of the bin maxima of the two nodes.
+
+double LundZTable::pick(double b, Rndm* rndmPtr) const {
+
+  // Neighbouring nodes, and their relative weights.
+  int    iB     = min( nB - 2, int( (log(b) - logBMin) / dLogB));
+  double wUpp   = (b - bNode[iB]) / (bNode[iB + 1] - bNode[iB]);
+  double wLow   = 1. - wUpp;
+  wUpp         *= normUpp[iB];
+  double sumLow = wLow * fCumBin[iB * nZ + nZ - 1];
+  double sumUpp = wUpp * fCumBin[(iB + 1) * nZ + nZ - 1];
+
+  // Pick node and bin from cumulative sum, and flat u inside the bin,
+  // all from one random number.
+  double u, fRat;
+  do {
+    double fNow = rndmPtr->flat() * (sumLow + sumUpp);
+    int iBNow = iB;
+    if (fNow < sumLow) fNow /= wLow;
+    else {
+      fNow = (fNow - sumLow) / wUpp;
+      ++iBNow;
+    }
+    const double* cumBeg = &fCumBin[iBNow * nZ];
+    int iZ = iGuide[iBNow * nZ + min( nZ - 1,
+      int( nZ * fNow / cumBeg[nZ - 1]))];
+    while (iZ < nZ - 1 && cumBeg[iZ] <= fNow) ++iZ;
+    double cumLow = (iZ > 0) ? cumBeg[iZ - 1] : 0.;
+    u = (iZ + min( 1., (fNow - cumLow) / (cumBeg[iZ] - cumLow))) / nZ;
+
+    // Accept by ratio of f to envelope, both relative to lower node.
+    fRat = (u > 0. && u < 1.) ? exp( logF( u, b) - logFNorm[iB])
+      / (wLow * fMaxBin[iB * nZ + iZ] + wUpp * fMaxBin[(iB + 1) * nZ + iZ])
+      : 0.;
+  } while (fRat < rndmPtr->flat());
+
+  // Done.
+  return u * u;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Logarithm of f(u) = z^(1/2) * (1 - z)^a * exp(-b/z) / z^c, z = u^2,
+// here times exp(b) so that nodes differ less. Endpoints as limits.
+
+double LundZTable::logF(double u, double b) const {
+
+  if (u <= 0.) return -1e300;
+  if (u >= 1.) return (aSave > 0.) ? -1e300 : 0.;
+  double z = u * u;
+  double logFNow = -b * (1. / z - 1.) - (cSave - 0.5) * log(z);
+  if (aSave > 0.) logFNow += aSave * log(1. - z);
+  return logFNow;
+
+}
+
+//==========================================================================
+
 // The StringZ class.
 
 //--------------------------------------------------------------------------
@@ -1523,6 +1663,10 @@ const double StringZ::AFROMC     = 0.01;
 // Do not take exponent of too large or small number.
 const double StringZ::EXPMAX     = 50.;
 
+// Range of b = bLund * mT2 values covered by the optional tables.
+const double StringZ::BTABLEMIN  = 0.01;
+const double StringZ::BTABLEMAX  = 100.;
+
 //--------------------------------------------------------------------------
 
 // Initialize data members of the string z selection.
@@ -1575,6 +1719,32 @@ void StringZ::init() {
   stopNF        = parm("StringFragmentation:stopNewFlav");
   stopS         = parm("StringFragmentation:stopSmear");
 
+  // Optional tables of the Lund function, for light, c and b fragmenting
+  // flavour. Old and new flavours ordinary, s quark or diquark, where the
+  // old heavy flavour cannot be an s quark. Share tables with same a, c.
+  useTable      = flag("StringZ:useTable");
+  tables.clear();
+  for (int iFrag = 0; iFrag < 3; ++iFrag)
+  for (int iOld = 0; iOld < 3; ++iOld)
+  for (int iNew = 0; iNew < 3; ++iNew) {
+    iTable[iFrag][iOld][iNew] = -1;
+    if (!useTable || (iFrag > 0 && iOld == 1)) continue;
+    int idFrag = (iFrag == 0) ? 1 : iFrag + 3;
+    if (iFrag == 1 && usePetersonC) continue;
+    if (iFrag == 2 && usePetersonB) continue;
+    double aShape, bNow, cShape;
+    shapeLund( idFrag, iOld == 1, iNew == 1, iOld == 2, iNew == 2, 1.,
+      aShape, bNow, cShape);
+    for (int iTab = 0; iTab < int(tables.size()); ++iTab)
+      if (tables[iTab].a() == aShape && tables[iTab].c() == cShape)
+        iTable[iFrag][iOld][iNew] = iTab;
+    if (iTable[iFrag][iOld][iNew] >= 0) continue;
+    iTable[iFrag][iOld][iNew] = tables.size();
+    tables.push_back( LundZTable());
+    tables.back().init( aShape, cShape, mode("StringZ:tableNodes"),
+      mode("StringZ:tableBins"), BTABLEMIN, BTABLEMAX);
+  }
+
 }
 
 //--------------------------------------------------------------------------
@@ -1651,9 +1821,40 @@ double StringZ::zFrag( int idOld, int idNew, double mT2) {
     return zPeterson( epsilon);
   }
 
+  // Shape parameters of Lund symmetric fragmentation function.
+  double aShape, bNow, cShape;
+  shapeLund( idFrag, isOldSQuark, isNewSQuark, isOldDiquark, isNewDiquark,
+    mT2, aShape, bNow, cShape);
+  double bShape = bNow * mT2;
+  if (!infoPtr->weightContainerPtr->weightsFragmentation.
+    weightParms[WeightsFragmentation::Z].empty())
+    return zLund(aShape, bShape, cShape, 10, bNow, idFrag, isOldSQuark,
+      isNewSQuark, isOldDiquark, isNewDiquark);
+
+  // Optionally use tabulated function, when inside its range.
+  if (useTable && idFrag <= 5) {
+    int iTab = iTable[max( 0, idFrag - 3)]
+      [isOldSQuark ? 1 : (isOldDiquark ? 2 : 0)]
+      [isNewSQuark ? 1 : (isNewDiquark ? 2 : 0)];
+    if (iTab >= 0 && tables[iTab].inRange(bShape))
+      return tables[iTab].pick( bShape, rndmPtr);
+  }
+  return zLund( aShape, bShape, cShape);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Shape parameters a, b/mT2 and c of the Lund function for given
+// flavours. Only c depends on mT2, and that only for idFrag > 5.
+
+void StringZ::shapeLund(int idFrag, bool isOldSQuark, bool isNewSQuark,
+  bool isOldDiquark, bool isNewDiquark, double mT2, double& aShape,
+  double& bNow, double& cShape) const {
+
   // Nonstandard a and b values implemented for heavy flavours.
   double aNow = aLund;
-  double bNow = bLund;
+  bNow = bLund;
   if (idFrag == 4 && useNonStandC) {
     aNow = aNonC;
     bNow = bNonC;
@@ -1666,11 +1867,10 @@ double StringZ::zFrag( int idOld, int idNew, double mT2) {
   }
 
   // Shape parameters of Lund symmetric fragmentation function.
-  double aShape = aNow;
+  aShape = aNow;
   if (isOldSQuark)  aShape += aExtraSQuark;
   if (isOldDiquark) aShape += aExtraDiquark;
-  double bShape = bNow * mT2;
-  double cShape = 1.;
+  cShape = 1.;
   if (isOldSQuark)  cShape -= aExtraSQuark;
   if (isNewSQuark)  cShape += aExtraSQuark;
   if (isOldDiquark) cShape -= aExtraDiquark;
@@ -1678,11 +1878,6 @@ double StringZ::zFrag( int idOld, int idNew, double mT2) {
   if (idFrag == 4) cShape += rFactC * bNow * mc2;
   if (idFrag == 5) cShape += rFactB * bNow * mb2;
   if (idFrag >  5) cShape += rFactH * bNow * mT2;
-  if (!infoPtr->weightContainerPtr->weightsFragmentation.
-    weightParms[WeightsFragmentation::Z].empty())
-    return zLund(aShape, bShape, cShape, 10, bNow, idFrag, isOldSQuark,
-      isNewSQuark, isOldDiquark, isNewDiquark);
-  else return zLund( aShape, bShape, cShape);
 
 }
 
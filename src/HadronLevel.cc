@@ -40,6 +40,99 @@ public:
 
 //==========================================================================
 
+// The StringWorker class.
+// Used to fragment strings in parallel, with private copies of the objects
+// involved, and a private copy of the event to fragment each string in.
+
+//--------------------------------------------------------------------------
+
+class HadronLevel::StringWorker {
+
+public:
+
+  // Set up fragmentation objects that use own random numbers.
+  void init(Info& infoIn);
+
+  // Fragment one string in the private event copy, with random numbers
+  // from the given sub-stream, and store the outcome.
+  void fragment(int iSub, uint64_t seed, const ColConfig& colConfig,
+    int sizeOld, StringOutput& out);
+
+  // Private event copy, information and random numbers.
+  Event event;
+  Info  info;
+  Rndm  rndm;
+
+  // Private fragmentation objects.
+  StringFlav flavSel;
+  StringPT   pTSel;
+  StringZ    zSel;
+  StringFragmentation stringFrag;
+
+};
+
+//--------------------------------------------------------------------------
+
+// Set up fragmentation objects that use own random numbers, but otherwise
+// the same settings, particle data and other shared objects.
+
+void HadronLevel::StringWorker::init(Info& infoIn) {
+
+  info.setPtrs( infoIn.settingsPtr, infoIn.particleDataPtr,
+    infoIn.loggerPtr, &rndm, infoIn.beamSetupPtr, infoIn.coupSMPtr,
+    infoIn.coupSUSYPtr, infoIn.partonSystemsPtr, infoIn.sigmaTotPtr,
+    infoIn.sigmaCmbPtr, infoIn.hadronWidthsPtr, infoIn.weightContainerPtr);
+  flavSel.initInfoPtr(info);
+  pTSel.initInfoPtr(info);
+  zSel.initInfoPtr(info);
+  stringFrag.initInfoPtr(info);
+  flavSel.init();
+  pTSel.init();
+  zSel.init();
+  stringFrag.init(&flavSel, &pTSel, &zSel);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fragment one string in the private event copy. Entries beyond sizeOld
+// are from previous strings, and are removed first.
+
+void HadronLevel::StringWorker::fragment(int iSub, uint64_t seed,
+  const ColConfig& colConfig, int sizeOld, StringOutput& out) {
+
+  // Reset the event and random numbers, and fragment.
+  event.popBack( event.size() - sizeOld);
+  rndm.initSubStream(seed);
+  out.entries.clear();
+  out.iChanged.clear();
+  out.statusChanged.clear();
+  out.daughter1Changed.clear();
+  out.daughter2Changed.clear();
+  out.iJunction = -1;
+  out.isOK = stringFrag.fragment( iSub, colConfig, event);
+  if (!out.isOK) return;
+
+  // Store new entries, and the changes of partons and junction.
+  for (int i = sizeOld; i < event.size(); ++i)
+    out.entries.push_back( event[i]);
+  const vector<int>& iParton = colConfig[iSub].iParton;
+  for (int i : iParton) if (i >= 0 && i < sizeOld) {
+    out.iChanged.push_back( i);
+    out.statusChanged.push_back( event[i].status());
+    out.daughter1Changed.push_back( event[i].daughter1());
+    out.daughter2Changed.push_back( event[i].daughter2());
+  }
+  if (iParton[0] < 0) {
+    out.iJunction = (-iParton[0]) / 10 - 1;
+    for (int leg = 0; leg < 3; ++leg)
+      out.statusJunction[leg] = event.statusJunction( out.iJunction, leg);
+  }
+
+}
+
+//==========================================================================
+
 // The HadronLevel class.
 
 //--------------------------------------------------------------------------
@@ -107,6 +200,18 @@ bool HadronLevel::init( TimeShowerPtr timesDecPtr, RHadrons* rHadronsPtrIn,
   stringFrag.init(&flavSel, &pTSel, &zSel, fragmentationModifierPtr);
   ministringFrag.init(&flavSel, &pTSel, &zSel);
 
+  // Optionally fragment strings on several threads, each with own objects.
+  int nThreadsFrag = mode("StringFragmentation:nThreads");
+  fragThreadPoolPtr = nullptr;
+  stringWorkers.clear();
+  if (nThreadsFrag > 1) {
+    fragThreadPoolPtr = make_shared<ThreadPool>(nThreadsFrag);
+    for (int iThread = 0; iThread < nThreadsFrag; ++iThread) {
+      stringWorkers.push_back( make_shared<StringWorker>());
+      stringWorkers.back()->init( *infoPtr);
+    }
+  }
+
   // Initialize particle decays.
   decays.init(timesDecPtr, &flavSel, decayHandlePtr, handledParticles);
 
@@ -244,9 +349,21 @@ bool HadronLevel::next( Event& event) {
       // MiniStringFragmentation needs to know if the event is diffractive.
       bool isDiff = infoPtr->isDiffractiveA() || infoPtr->isDiffractiveB();
 
+      // Optionally fragment normal strings in parallel.
+      bool doParallelNow = fragThreadPoolPtr && canFragmentInParallel();
+
       // Process all colour singlet (sub)systems.
       for (int iSub = 0; iSub < colConfig.size(); ++iSub) {
 
+        // Normal strings come after the ministrings, and may then be done
+        // in parallel.
+        if (doParallelNow && colConfig[iSub].massExcess > mStringMin) {
+          doParallelNow = false;
+          iSub = fragmentInParallel( iSub, event);
+          if (iSub < 0) return false;
+          if (iSub == colConfig.size()) break;
+        }
+
         // Collect sequentially all partons in a colour singlet subsystem.
         colConfig.collect(iSub, event);
         int nBefFrag = event.size();
@@ -527,6 +644,123 @@ bool HadronLevel::findSinglets(Event& event, bool keepJunctions) {
 
 //--------------------------------------------------------------------------
 
+// Check whether strings may be fragmented in parallel. Not when user hooks,
+// string interactions or weight variations may act during fragmentation.
+
+bool HadronLevel::canFragmentInParallel() {
+
+  if (userHooksPtr && userHooksPtr->canChangeFragPar()) return false;
+  if (fragmentationModifierPtr) return false;
+  for (const map<vector<double>, int>& parms : infoPtr->weightContainerPtr
+    ->weightsFragmentation.weightParms) if (!parms.empty()) return false;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fragment the normal strings from iSubBeg onwards in parallel. Returns
+// the first system still to be processed, or -1 if fragmentation failed.
+// The hadrons of each string come after the partons of all strings,
+// unlike when the strings are collected and fragmented one by one.
+
+int HadronLevel::fragmentInParallel(int iSubBeg, Event& event) {
+
+  // Range of normal strings. Only worthwhile for at least two.
+  int iSubEnd = iSubBeg;
+  while (iSubEnd < colConfig.size()
+    && colConfig[iSubEnd].massExcess > mStringMin) ++iSubEnd;
+  int nString = iSubEnd - iSubBeg;
+  if (nString < 2) return iSubBeg;
+
+  // Collect the partons of all strings before any is fragmented.
+  for (int iSub = iSubBeg; iSub < iSubEnd; ++iSub)
+    colConfig.collect(iSub, event);
+  int sizeOld = event.size();
+
+  // One draw from the standard random numbers gives the seeds of the
+  // sub-streams of all strings. Pass on event information.
+  uint64_t seedEvent = (uint64_t(16777216. * rndmPtr->flat()) << 24)
+    + uint64_t(16777216. * rndmPtr->flat());
+  for (shared_ptr<StringWorker>& workerPtr : stringWorkers)
+    workerPtr->info.setPartEvolved( infoPtr->nMPI(), infoPtr->nISR());
+
+  // The seed of each string is the SplitMix64 output for step iString + 1
+  // from seedEvent. Both steps are bijective, so all seeds of an event are
+  // different, whatever the number of strings.
+  auto stringSeed = [seedEvent](int iString) {
+    uint64_t z = seedEvent + uint64_t(iString + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  };
+
+  // Each thread copies the event when it gets its first string, and then
+  // takes strings until none are left. The outcome only depends on the
+  // string, not on the thread or the order.
+  stringOutputs.resize(nString);
+  atomic<int> iStringNext(0);
+  fragThreadPoolPtr->run( stringWorkers.size(), [&](int iWorker) {
+    StringWorker& worker = *stringWorkers[iWorker];
+    bool hasEvent = false;
+    for (int iString = iStringNext++; iString < nString;
+      iString = iStringNext++) {
+      if (!hasEvent) worker.event = event;
+      hasEvent = true;
+      worker.fragment( iSubBeg + iString, stringSeed(iString),
+        colConfig, sizeOld, stringOutputs[iString]);
+    }
+  });
+
+  // Insert the outcome in the original order, with indices of new entries
+  // shifted to their final positions. A failed string is optionally given
+  // to ministring fragmentation, as without threads.
+  bool isDiff = infoPtr->isDiffractiveA() || infoPtr->isDiffractiveB();
+  for (int iString = 0; iString < nString; ++iString) {
+    StringOutput& out = stringOutputs[iString];
+    int nBefFrag = event.size();
+    if (!out.isOK) {
+      if (!tryMiniAfterFailedFrag) return -1;
+      loggerPtr->ERROR_MSG("string fragmentation failed, "
+        "trying ministring fragmetation instead");
+      if (!ministringFrag.fragment( iSubBeg + iString, colConfig, event,
+        isDiff)) {
+        loggerPtr->ERROR_MSG("also ministring fragmentation failed "
+          "after failed normal fragmentation");
+        return -1;
+      }
+      if (doPartonVertex) partonVertexPtr->vertexHadrons( nBefFrag, event);
+      continue;
+    }
+    int shift    = nBefFrag - sizeOld;
+    auto shifted = [=](int i) { return (i >= sizeOld) ? i + shift : i; };
+    for (const Particle& entry : out.entries) {
+      int iNew = event.append( entry);
+      event[iNew].mothers( shifted(entry.mother1()),
+        shifted(entry.mother2()));
+      event[iNew].daughters( shifted(entry.daughter1()),
+        shifted(entry.daughter2()));
+    }
+    for (int i = 0; i < int(out.iChanged.size()); ++i) {
+      Particle& parton = event[out.iChanged[i]];
+      parton.status( out.statusChanged[i]);
+      parton.daughters( shifted(out.daughter1Changed[i]),
+        shifted(out.daughter2Changed[i]));
+    }
+    if (out.iJunction >= 0) for (int leg = 0; leg < 3; ++leg)
+      event.statusJunction( out.iJunction, leg, out.statusJunction[leg]);
+
+    // Displace hadron vertices transversely from parton MPI + shower.
+    if (doPartonVertex) partonVertexPtr->vertexHadrons( nBefFrag, event);
+  }
+
+  // Done.
+  return iSubEnd;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Extract rapidity pairs of string pieces. Store in form [yCol, yAcol].
 
 vector< vector< pair<double,double> > > HadronLevel::rapidityPairs(
@@ -1575,11 +1575,14 @@ bool Angantyr::addNucleusRemnants() {
   int npp = 0;
   int nnp = 0;
   Vec4 ppsum;
+  // Beam energies per nucleon, looked up once rather than per nucleon.
+  double eProj = pythia[HADRON]->parm("Beams:eA");
+  double eTarg = pythia[HADRON]->parm("Beams:eB");
   for (const Nucleon& nucleon : proj) {
     if (nucleon.event())
       hiInfo.addProjectileNucleon(nucleon);
     else {
-      double e = pythia[HADRON]->parm("Beams:eA");
+      double e = eProj;
       double m = pythia[HADRON]->particleData.m0(nucleon.id());
       double pz = sqrt(max(e*e - m*m, 0.0));
       if ( nucleon.id() == 2212 ) {
@@ -1599,7 +1602,7 @@ bool Angantyr::addNucleusRemnants() {
     if (nucleon.event())
       hiInfo.addTargetNucleon(nucleon);
     else {
-      double e = pythia[HADRON]->parm("Beams:eB");
+      double e = eTarg;
       double m = pythia[HADRON]->particleData.m0(nucleon.id());
       double pz = -sqrt(max(e*e - m*m, 0.0));
       if ( nucleon.id() == 2212 ) {
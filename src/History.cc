@@ -8657,22 +8657,22 @@ double History::pTLund(const Event& event, int rad, int emt, int rec,
 
   // Use external shower for merging.
   if ( mergingHooksPtr->useShowerPlugin() ) {
-    map<string,double> stateVars;
+    StateVariables stateVars;
     bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
     if (isFSR) {
       string name = showers->timesPtr->getSplittingName(event, rad, emt,
         rec).front();
-      stateVars   = showers->timesPtr->getStateVariables(event, rad, emt, rec,
+      stateVars   = showers->timesPtr->stateVariables(event, rad, emt, rec,
         name);
     } else {
       string name = showers->spacePtr->getSplittingName(event, rad, emt,
         rec).front();
-      stateVars   = showers->spacePtr->getStateVariables(event, rad, emt, rec,
+      stateVars   = showers->spacePtr->stateVariables(event, rad, emt, rec,
         name);
     }
 
-    return ( (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-             ? sqrt(stateVars["t"]) : -1.0 );
+    return ( stateVars.has(StateVariables::T)
+             ? sqrt(stateVars[StateVariables::T]) : -1.0 );
   }
 
   // Save type: 1 = FSR pT definition, else ISR definition
@@ -9577,22 +9577,21 @@ double History::getShowerPluginScale(const Event& event, int rad, int emt,
   if ( !mergingHooksPtr->useShowerPlugin() ) return scalePythia;
 
   // Retrieve state variables.
-  map<string,double> stateVars;
+  StateVariables stateVars;
   bool isFSR = showers->timesPtr->isTimelike(event, rad, emt, rec, "");
   if (isFSR) {
     string name = showers->timesPtr->getSplittingName(event, rad, emt,
       rec).front();
-    stateVars   = showers->timesPtr->getStateVariables(event, rad, emt, rec,
+    stateVars   = showers->timesPtr->stateVariables(event, rad, emt, rec,
       name);
   } else {
     string name = showers->spacePtr->getSplittingName(event, rad, emt,
       rec).front();
-    stateVars   = showers->spacePtr->getStateVariables(event, rad, emt, rec,
+    stateVars   = showers->spacePtr->stateVariables(event, rad, emt, rec,
       name);
   }
 
-  return ( (stateVars.size() > 0 && stateVars.find(key) != stateVars.end())
-           ? stateVars[key] : -1.0 );
+  return stateVars.get(key);
 
 }
 
@@ -209,9 +209,9 @@ double Info::getGroupWeight(int iGW) const {
 
 // List of all hard processes switched on.
 
-vector<int> Info::codesHard() {
+vector<int> Info::codesHard() const {
   vector<int> codesNow;
-  for (map<int, long>::iterator nTryEntry = nTryM.begin();
+  for (map<int, long>::const_iterator nTryEntry = nTryM.begin();
     nTryEntry != nTryM.end(); ++nTryEntry)
       codesNow.push_back( nTryEntry->first );
   return codesNow;
@@ -0,0 +1,185 @@
+// InitCache.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Function definitions (not found in the header) for the InitCache class.
+
+#include "Pythia8/InitCache.h"
+#include <chrono>
+#include <cstdio>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The InitCache class.
+
+//--------------------------------------------------------------------------
+
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Identifier at the beginning of a binary file.
+const string InitCache::FILETAG = "PYTHIA8INITCACHE";
+
+// Format version of the binary file. Increase when the layout of the
+// file, or of any product stored in it, is changed.
+const int InitCache::FILEVERSION = 1;
+
+//--------------------------------------------------------------------------
+
+// Write all products to a binary file. Done to a temporary file that is
+// then renamed, so that other jobs never read a partially written file.
+
+bool InitCache::writeFile(const string& fileName,
+  const string& config) const {
+
+  // Open temporary file, with a name unlikely to be used by other jobs.
+  string tmpName = fileName + ".tmp" + hash( to_string(
+    std::chrono::high_resolution_clock::now().time_since_epoch().count()) );
+  ofstream os(tmpName.c_str(), ios::binary);
+  if (!os.good()) return false;
+
+  // Helper methods to write integers and strings.
+  auto writeInt = [&os](long long i) {
+    os.write( (const char*) &i, sizeof(long long));};
+  auto writeString = [&os, &writeInt](const string& text) {
+    writeInt(text.size()); os.write( text.data(), text.size());};
+
+  // Header with identifier, version and configuration.
+  writeString(FILETAG);
+  writeInt(FILEVERSION);
+  writeString(config);
+
+  // Products, in order of key.
+  lock_guard<mutex> lock(cacheMutex);
+  writeInt(products.size());
+  for (auto iter = products.begin(); iter != products.end(); ++iter) {
+    writeString(iter->first);
+    const vector<double>& data = *iter->second;
+    writeInt(data.size());
+    os.write( (const char*) data.data(), sizeof(double) * data.size());
+  }
+
+  // Rename to final name when complete.
+  os.close();
+  if (!os) {
+    remove(tmpName.c_str());
+    return false;
+  }
+  return (rename(tmpName.c_str(), fileName.c_str()) == 0);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read products from a binary file. Existing products are kept.
+
+bool InitCache::readFile(const string& fileName, const string& config) {
+
+  // Open file.
+  ifstream is(fileName.c_str(), ios::binary);
+  if (!is.good()) return false;
+
+  // Helper methods to read integers and strings, with sanity limits.
+  auto readInt = [&is]() {
+    long long i = -1;
+    is.read( (char*) &i, sizeof(long long));
+    return is ? i : -1;};
+  auto readString = [&is, &readInt](string& text) {
+    long long n = readInt();
+    if (n < 0 || n > 100000000) return false;
+    text.resize(n);
+    if (n > 0) is.read( &text[0], n);
+    return bool(is);};
+
+  // Header must match identifier, version and configuration.
+  string text;
+  if (!readString(text) || text != FILETAG) return false;
+  if (readInt() != FILEVERSION) return false;
+  if (!readString(text) || text != config) return false;
+
+  // Read products into a temporary map, so nothing is changed on failure.
+  map<string, shared_ptr<const vector<double> > > productsIn;
+  long long nProducts = readInt();
+  if (nProducts < 0) return false;
+  for (long long iProduct = 0; iProduct < nProducts; ++iProduct) {
+    string key;
+    if (!readString(key)) return false;
+    long long nData = readInt();
+    if (nData < 0 || nData > 100000000) return false;
+    vector<double> data(nData);
+    is.read( (char*) data.data(), sizeof(double) * nData);
+    if (!is) return false;
+    productsIn[key] = make_shared<const vector<double> >(move(data));
+  }
+
+  // Add products that are not already present.
+  lock_guard<mutex> lock(cacheMutex);
+  products.insert( productsIn.begin(), productsIn.end());
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Look up a product, first waiting for any claim on it to be settled.
+
+shared_ptr<const vector<double> > InitCache::wait(const string& key) {
+
+  std::unique_lock<mutex> lock(cacheMutex);
+  claimDone.wait(lock, [&] { return claims.find(key) == claims.end(); });
+  auto iter = products.find(key);
+  if (iter == products.end()) return nullptr;
+  ++nFoundSave;
+  return iter->second;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Hash of a string, using the 64-bit FNV-1a algorithm.
+
+string InitCache::hash(const string& text) {
+
+  unsigned long long h = 14695981039346656037ULL;
+  for (unsigned char c : text) {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  string hexDigits = "0123456789abcdef";
+  string result(16, '0');
+  for (int i = 15; i >= 0; --i) {
+    result[i] = hexDigits[h & 15];
+    h >>= 4;
+  }
+  return result;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Random-number seed derived from a key and a base seed, between 1 and
+// 900,000,000, for initialization steps that are run with a random-number
+// stream of their own, so that their outcome does not depend on the
+// instance running them, but does on the base seed of the run.
+
+int InitCache::seed(const string& key, int seedBase) {
+
+  unsigned long long h = 14695981039346656037ULL;
+  for (int i = 0; i < 4; ++i) {
+    h ^= (unsigned(seedBase) >> (8 * i)) & 0xffu;
+    h *= 1099511628211ULL;
+  }
+  for (unsigned char c : key) {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  return int(h % 900000000ULL) + 1;
+
+}
+
+//==========================================================================
+
+} // end namespace Pythia8
@@ -4,8 +4,8 @@
 // Please respect the MCnet Guidelines, see GUIDELINES for details.
 
 // This file is written by Stefan Prestel.
-// Function definitions (not found in the header) for the HardProcess and
-// MergingHooks classes.
+// Function definitions (not found in the header) for the StateVariables,
+// HardProcess and MergingHooks classes.
 
 #include "Pythia8/MergingHooks.h"
 #include "Pythia8/PartonLevel.h"
@@ -14,6 +14,69 @@ namespace Pythia8 {
 
 //==========================================================================
 
+// The StateVariables class.
+
+//--------------------------------------------------------------------------
+
+// Names of the standard variables, as used in the map representation.
+
+const string StateVariables::names[StateVariables::NVARIABLES] = { "t",
+  "tRS", "scaleAS", "scaleEM", "scalePDF", "z", "radBefID", "radBefCol",
+  "radBefAcol", "couplingType", "couplingValue", "m2dip" };
+
+//--------------------------------------------------------------------------
+
+// Index of a standard variable from its name, or -1 if not standard.
+
+int StateVariables::index(const string& nameIn) {
+  for (int i = 0; i < NVARIABLES; ++i) if (nameIn == names[i]) return i;
+  return -1;
+}
+
+//--------------------------------------------------------------------------
+
+// Set a variable by name.
+
+void StateVariables::set(const string& nameIn, double valueIn) {
+  int i = index(nameIn);
+  if (i >= 0) set( Index(i), valueIn);
+  else extra[nameIn] = valueIn;
+}
+
+//--------------------------------------------------------------------------
+
+// Check if a variable has been set, by name.
+
+bool StateVariables::has(const string& nameIn) const {
+  int i = index(nameIn);
+  return (i >= 0) ? has( Index(i) ) : extra.find(nameIn) != extra.end();
+}
+
+//--------------------------------------------------------------------------
+
+// Read a variable by name, with a default if it has not been set.
+
+double StateVariables::get(const string& nameIn, double valueDefault)
+  const {
+  int i = index(nameIn);
+  if (i >= 0) return has( Index(i) ) ? valueSave[i] : valueDefault;
+  auto it = extra.find(nameIn);
+  return (it != extra.end()) ? it->second : valueDefault;
+}
+
+//--------------------------------------------------------------------------
+
+// Convert to the map<string,double> representation.
+
+map<string,double> StateVariables::toMap() const {
+  map<string,double> ret(extra);
+  for (int i = 0; i < NVARIABLES; ++i)
+    if (has( Index(i) )) ret[names[i]] = valueSave[i];
+  return ret;
+}
+
+//==========================================================================
+
 // The HardProcess class.
 
 //--------------------------------------------------------------------------
@@ -3706,7 +3769,7 @@ double MergingHooks::rhoPythia(const Event& event, int rad, int emt, int rec,
   // Use external shower for merging.
   // Ask showers for evolution variable.
   if ( useShowerPlugin() ) {
-    map<string,double> stateVars;
+    StateVariables stateVars;
     double ptret = event[0].m();
     bool isFSR = showers->timesPtr->allowedSplitting(event, rad, emt);
     bool isISR = showers->spacePtr->allowedSplitting(event, rad, emt);
@@ -3717,11 +3780,11 @@ double MergingHooks::rhoPythia(const Event& event, int rad, int emt, int rec,
         vector<int> recsNow
           = showers->timesPtr->getRecoilers(event, rad, emt, names[iName]);
         for ( int i = 0; i < int(recsNow.size()); ++i ) {
-          stateVars = showers->timesPtr->getStateVariables(event, rad, emt,
+          stateVars = showers->timesPtr->stateVariables(event, rad, emt,
             recsNow[i], names[iName]);
           double pttemp = ptret;
-          if (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-            pttemp = sqrt(stateVars["t"]);
+          if (stateVars.has(StateVariables::T))
+            pttemp = sqrt(stateVars[StateVariables::T]);
           ptret = min(ptret,pttemp);
         }
       }
@@ -3734,11 +3797,11 @@ double MergingHooks::rhoPythia(const Event& event, int rad, int emt, int rec,
         vector<int> recsNow
           = showers->spacePtr->getRecoilers(event, rad, emt, names[iName]);
         for ( int i = 0; i < int(recsNow.size()); ++i ) {
-          stateVars = showers->spacePtr->getStateVariables(event, rad, emt,
+          stateVars = showers->spacePtr->stateVariables(event, rad, emt,
             recsNow[i], names[iName]);
           double pttemp = ptret;
-          if (stateVars.size() > 0 && stateVars.find("t") != stateVars.end())
-            pttemp = sqrt(stateVars["t"]);
+          if (stateVars.has(StateVariables::T))
+            pttemp = sqrt(stateVars[StateVariables::T]);
         ptret = min(ptret,pttemp);
         }
       }
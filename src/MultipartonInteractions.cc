@@ -7,6 +7,7 @@
 // SigmaMultiparton and MultipartonInteractions classes.
 
 #include "Pythia8/MultipartonInteractions.h"
+#include "Pythia8/InitCache.h"
 
 // Internal headers for special processes.
 #include "Pythia8/SigmaQCD.h"
@@ -358,8 +359,10 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
   partonVertexPtr  = partonVertexPtrIn;
   hasGamma         = hasGammaIn;
   if (!doMPIinit) {
-    mpis = vector<MPIInterpolationInfo>(1);
-    mpis[0].init(1);
+    shared_ptr<vector<MPIInterpolationInfo> > mpisNew
+      = make_shared<vector<MPIInterpolationInfo> >(1);
+    (*mpisNew)[0].init(1);
+    mpisPtr = mpisNew;
     return false;
   }
 
@@ -551,16 +554,53 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
   reuseInit = mode("MultipartonInteractions:reuseInit");
   initFile  = word("MultipartonInteractions:initFile");
   int idBsave = infoPtr->idB();
-  bool reuseWorked = (reuseInit == 2 || reuseInit == 3) && loadMPIdata();
+
+  // Alternatively take initialization data from a store shared with
+  // other instances, if available.
+  InitCache* initCachePtr = infoPtr->initCachePtr.get();
+  ostringstream cacheKey;
+  cacheKey << "MultipartonInteractions:" << iDiffSys << ":" << hasGamma
+           << ":" << infoPtr->idA() << ":" << idBsave << ":"
+           << setprecision(10) << eCM;
+  shared_ptr<const vector<double> > sharedData
+    = (initCachePtr != 0) ? initCachePtr->get(cacheKey.str()) : nullptr;
+
+  // Instances initialized at the same time wait for the one doing it.
+  bool hasClaim = false;
+  if (initCachePtr != 0 && sharedData == nullptr) {
+    hasClaim = initCachePtr->claim(cacheKey.str());
+    if (!hasClaim) sharedData = initCachePtr->wait(cacheKey.str());
+  }
+  // Tables already unpacked by another instance are used as they are.
+  bool reuseWorked = false;
+  if (sharedData != nullptr) {
+    mpisPtr = static_pointer_cast<const vector<MPIInterpolationInfo> >(
+      initCachePtr->getObject(cacheKey.str()));
+    if (mpisPtr != nullptr) {
+      nPDFA = mpisPtr->size();
+      useMPIdata();
+      reuseWorked = true;
+    } else reuseWorked = unpackMPIdata(*sharedData);
+  } else reuseWorked = (reuseInit == 2 || reuseInit == 3) && loadMPIdata();
+  shared_ptr<vector<MPIInterpolationInfo> > mpisNew;
   if (!reuseWorked) {
     if (reuseInit == 2) {
       loggerPtr->ABORT_MSG("failed to load MPI data");
+      if (hasClaim) initCachePtr->release(cacheKey.str());
       return false;
     }
     else
-      mpis = vector<MPIInterpolationInfo>(nPDFA);
+      mpisNew = make_shared<vector<MPIInterpolationInfo> >(nPDFA);
   }
 
+  // Optionally use a random-number stream of its own, so that the outcome
+  // does not depend on which instance does the initialization.
+  // The original state is restored on any return from here on.
+  bool separateStream = !reuseWorked && flag("Random:separateInitStreams");
+  RndmStateGuard rndmGuard( separateStream ? rndmPtr : nullptr);
+  if (separateStream) rndmPtr->init( InitCache::seed(cacheKey.str(),
+    infoPtr->seedInitStreams));
+
   // Loop over multiple beam A initializations if necessary.
   if (!reuseWorked)
   for (int iPA = 0; iPA < nPDFA; ++iPA) {
@@ -630,11 +670,12 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
     }
 
     // Save for possible reuse.
-    mpis[iPA].nStepSave     = nStep;
-    mpis[iPA].eStepMinSave  = eStepMin;
-    mpis[iPA].eStepMaxSave  = eStepMax;
-    mpis[iPA].eStepSizeSave = eStepSize;
-    mpis[iPA].init(nStep);
+    MPIInterpolationInfo& mpiNow = (*mpisNew)[iPA];
+    mpiNow.nStepSave     = nStep;
+    mpiNow.eStepMinSave  = eStepMin;
+    mpiNow.eStepMaxSave  = eStepMax;
+    mpiNow.eStepSizeSave = eStepSize;
+    mpiNow.init(nStep);
 
     // Loop over masses for which to initialize generation.
     for (int iStep = 0; iStep < nStep; ++iStep) {
@@ -773,6 +814,7 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
         if ( max(pT0, pTmin) < max(PT0MIN, Lambda3) ) {
           loggerPtr->ERROR_MSG("failed to find acceptable pT0 and pTmin");
           infoPtr->setTooLowPTmin(true);
+          if (hasClaim) initCachePtr->release(cacheKey.str());
           return false;
         }
       }
@@ -790,25 +832,26 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
       sigmaMaxViol = max( sigmaMaxViol, pT4dSigmaMax / pT4dSigmaMaxBeg);
 
       // Save values calculated.
-      if (nStep > 1 || reuseInit == 1 || reuseInit == 3) {
-        mpis[iPA].pT0Save[iStep]          = pT0;
-        mpis[iPA].pT4dSigmaMaxSave[iStep] = pT4dSigmaMax;
-        mpis[iPA].pT4dProbMaxSave[iStep]  = pT4dProbMax;
-        mpis[iPA].sigmaIntSave[iStep]     = sigmaInt;
+      if (nStep > 1 || reuseInit == 1 || reuseInit == 3
+        || initCachePtr != 0) {
+        mpiNow.pT0Save[iStep]          = pT0;
+        mpiNow.pT4dSigmaMaxSave[iStep] = pT4dSigmaMax;
+        mpiNow.pT4dProbMaxSave[iStep]  = pT4dProbMax;
+        mpiNow.sigmaIntSave[iStep]     = sigmaInt;
         for (int j = 0; j <= 100; ++j)
-          mpis[iPA].sudExpPTSave[iStep][j] = sudExpPT[j];
-        mpis[iPA].zeroIntCorrSave[iStep]  = zeroIntCorr;
-        mpis[iPA].normOverlapSave[iStep]  = normOverlap;
-        mpis[iPA].kNowSave[iStep]         = kNow;
-        mpis[iPA].bAvgSave[iStep]         = bAvg;
-        mpis[iPA].bDivSave[iStep]         = bDiv;
-        mpis[iPA].probLowBSave[iStep]     = probLowB;
-        mpis[iPA].fracAhighSave[iStep]    = fracAhigh;
-        mpis[iPA].fracBhighSave[iStep]    = fracBhigh;
-        mpis[iPA].fracChighSave[iStep]    = fracBhigh;
-        mpis[iPA].fracABChighSave[iStep]  = fracABChigh;
-        mpis[iPA].cDivSave[iStep]         = cDiv;
-        mpis[iPA].cMaxSave[iStep]         = cMax;
+          mpiNow.sudExpPTSave[iStep][j] = sudExpPT[j];
+        mpiNow.zeroIntCorrSave[iStep]  = zeroIntCorr;
+        mpiNow.normOverlapSave[iStep]  = normOverlap;
+        mpiNow.kNowSave[iStep]         = kNow;
+        mpiNow.bAvgSave[iStep]         = bAvg;
+        mpiNow.bDivSave[iStep]         = bDiv;
+        mpiNow.probLowBSave[iStep]     = probLowB;
+        mpiNow.fracAhighSave[iStep]    = fracAhigh;
+        mpiNow.fracBhighSave[iStep]    = fracBhigh;
+        mpiNow.fracChighSave[iStep]    = fracBhigh;
+        mpiNow.fracABChighSave[iStep]  = fracABChigh;
+        mpiNow.cDivSave[iStep]         = cDiv;
+        mpiNow.cMaxSave[iStep]         = cMax;
       }
 
     // End of loop over energies or diffractive/invariant gamma+gamma masses.
@@ -840,9 +883,17 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
       loggerPtr->WARNING_MSG("maximum increased", osWarn.str());
     }
 
-  // End of internal initialization. Optionally store outcome for reuse.
+  // End of internal initialization. Optionally store outcome for reuse,
+  // and share the tables with other instances using the same outcome.
   }
+  if (!reuseWorked) mpisPtr = mpisNew;
 
+  if (initCachePtr != 0) {
+    if (!reuseWorked || hasClaim)
+      initCachePtr->set( cacheKey.str(), packMPIdata());
+    mpisPtr = static_pointer_cast<const vector<MPIInterpolationInfo> >(
+      initCachePtr->setObject( cacheKey.str(), mpisPtr));
+  }
   if (reuseInit == 1 || (reuseInit == 3 && !reuseWorked) ) {
     if (saveMPIdata())
       loggerPtr->INFO_MSG("wrote initialization data to file", initFile);
@@ -911,11 +962,12 @@ void MultipartonInteractions::reset( ) {
   } else sigmaND = sigmaPomP * pow( eCM / mPomP, pPomP);
 
   // Update interpolation data.
+  const MPIInterpolationInfo& mpiNow = (*mpisPtr)[iPDFA];
   iPDFAsave = iPDFA;
-  nStep     = mpis[iPDFA].nStepSave;
-  eStepMin  = mpis[iPDFA].eStepMinSave;
-  eStepMax  = mpis[iPDFA].eStepMaxSave;
-  eStepSize = mpis[iPDFA].eStepSizeSave;
+  nStep     = mpiNow.nStepSave;
+  eStepMin  = mpiNow.eStepMinSave;
+  eStepMax  = mpiNow.eStepMaxSave;
+  eStepSize = mpiNow.eStepSizeSave;
 
   // Current interpolation point.
   eCMsave   = eCM;
@@ -926,8 +978,8 @@ void MultipartonInteractions::reset( ) {
   eStepFrom = 1. - eStepTo;
 
   // Update pT0 and combinations derived from it.
-  pT0           = eStepFrom * mpis[iPDFA].pT0Save[iStepFrom]
-                + eStepTo   * mpis[iPDFA].pT0Save[iStepTo];
+  pT0           = eStepFrom * mpiNow.pT0Save[iStepFrom]
+                + eStepTo   * mpiNow.pT0Save[iStepTo];
   pT20          = pT0*pT0;
   pT2min        = pTmin*pTmin;
   pTmax         = 0.5*eCM;
@@ -939,41 +991,41 @@ void MultipartonInteractions::reset( ) {
   pT2maxmin     = pT2max - pT2min;
 
   // Update other parameters used in pT choice.
-  pT4dSigmaMax  = eStepFrom * mpis[iPDFA].pT4dSigmaMaxSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].pT4dSigmaMaxSave[iStepTo];
-  pT4dProbMax   = eStepFrom * mpis[iPDFA].pT4dProbMaxSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].pT4dProbMaxSave[iStepTo];
-  sigmaInt      = eStepFrom * mpis[iPDFA].sigmaIntSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].sigmaIntSave[iStepTo];
+  pT4dSigmaMax  = eStepFrom * mpiNow.pT4dSigmaMaxSave[iStepFrom]
+                + eStepTo   * mpiNow.pT4dSigmaMaxSave[iStepTo];
+  pT4dProbMax   = eStepFrom * mpiNow.pT4dProbMaxSave[iStepFrom]
+                + eStepTo   * mpiNow.pT4dProbMaxSave[iStepTo];
+  sigmaInt      = eStepFrom * mpiNow.sigmaIntSave[iStepFrom]
+                + eStepTo   * mpiNow.sigmaIntSave[iStepTo];
   for (int j = 0; j <= 100; ++j)
-    sudExpPT[j] = eStepFrom * mpis[iPDFA].sudExpPTSave[iStepFrom][j]
-                + eStepTo   * mpis[iPDFA].sudExpPTSave[iStepTo][j];
+    sudExpPT[j] = eStepFrom * mpiNow.sudExpPTSave[iStepFrom][j]
+                + eStepTo   * mpiNow.sudExpPTSave[iStepTo][j];
 
   // Update parameters related to the impact-parameter picture.
-  zeroIntCorr   = eStepFrom * mpis[iPDFA].zeroIntCorrSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].zeroIntCorrSave[iStepTo];
-  normOverlap   = eStepFrom * mpis[iPDFA].normOverlapSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].normOverlapSave[iStepTo];
-  kNow          = eStepFrom * mpis[iPDFA].kNowSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].kNowSave[iStepTo];
-  bAvg          = eStepFrom * mpis[iPDFA].bAvgSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].bAvgSave[iStepTo];
-  bDiv          = eStepFrom * mpis[iPDFA].bDivSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].bDivSave[iStepTo];
-  probLowB      = eStepFrom * mpis[iPDFA].probLowBSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].probLowBSave[iStepTo];
-  fracAhigh     = eStepFrom * mpis[iPDFA].fracAhighSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].fracAhighSave[iStepTo];
-  fracBhigh     = eStepFrom * mpis[iPDFA].fracBhighSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].fracBhighSave[iStepTo];
-  fracChigh     = eStepFrom * mpis[iPDFA].fracChighSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].fracChighSave[iStepTo];
-  fracABChigh   = eStepFrom * mpis[iPDFA].fracABChighSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].fracABChighSave[iStepTo];
-  cDiv          = eStepFrom * mpis[iPDFA].cDivSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].cDivSave[iStepTo];
-  cMax          = eStepFrom * mpis[iPDFA].cMaxSave[iStepFrom]
-                + eStepTo   * mpis[iPDFA].cMaxSave[iStepTo];
+  zeroIntCorr   = eStepFrom * mpiNow.zeroIntCorrSave[iStepFrom]
+                + eStepTo   * mpiNow.zeroIntCorrSave[iStepTo];
+  normOverlap   = eStepFrom * mpiNow.normOverlapSave[iStepFrom]
+                + eStepTo   * mpiNow.normOverlapSave[iStepTo];
+  kNow          = eStepFrom * mpiNow.kNowSave[iStepFrom]
+                + eStepTo   * mpiNow.kNowSave[iStepTo];
+  bAvg          = eStepFrom * mpiNow.bAvgSave[iStepFrom]
+                + eStepTo   * mpiNow.bAvgSave[iStepTo];
+  bDiv          = eStepFrom * mpiNow.bDivSave[iStepFrom]
+                + eStepTo   * mpiNow.bDivSave[iStepTo];
+  probLowB      = eStepFrom * mpiNow.probLowBSave[iStepFrom]
+                + eStepTo   * mpiNow.probLowBSave[iStepTo];
+  fracAhigh     = eStepFrom * mpiNow.fracAhighSave[iStepFrom]
+                + eStepTo   * mpiNow.fracAhighSave[iStepTo];
+  fracBhigh     = eStepFrom * mpiNow.fracBhighSave[iStepFrom]
+                + eStepTo   * mpiNow.fracBhighSave[iStepTo];
+  fracChigh     = eStepFrom * mpiNow.fracChighSave[iStepFrom]
+                + eStepTo   * mpiNow.fracChighSave[iStepTo];
+  fracABChigh   = eStepFrom * mpiNow.fracABChighSave[iStepFrom]
+                + eStepTo   * mpiNow.fracABChighSave[iStepTo];
+  cDiv          = eStepFrom * mpiNow.cDivSave[iStepFrom]
+                + eStepTo   * mpiNow.cDivSave[iStepTo];
+  cMax          = eStepFrom * mpiNow.cMaxSave[iStepFrom]
+                + eStepTo   * mpiNow.cMaxSave[iStepTo];
 
 }
 
@@ -1709,7 +1761,7 @@ bool MultipartonInteractions::saveMPIdata() {
 
   // Loop over number of different PDF sets, and thereby projectiles.
   for (int iPA = 0; iPA < nPDFA; ++iPA) {
-    MPIInterpolationInfo& mpiNow = mpis[iPA];
+    const MPIInterpolationInfo& mpiNow = (*mpisPtr)[iPA];
     os << mpiNow.nStepSave << " " << mpiNow.eStepMinSave << " "
        << mpiNow.eStepMaxSave << " " << mpiNow.eStepSizeSave << endl;
     int nStepTmp = mpiNow.nStepSave;
@@ -1768,13 +1820,13 @@ bool MultipartonInteractions::loadMPIdata() {
   }
   if (!foundMatch) return false;
 
-  // Need to set up minimal mpis array for iDiffSys = 2 or 3.
-  if (mpis.size() == 0)
-    mpis  = vector<MPIInterpolationInfo>(nPDFA);
+  // Set up new tables, with the number of PDF sets found in the file.
+  shared_ptr<vector<MPIInterpolationInfo> > mpisNew
+    = make_shared<vector<MPIInterpolationInfo> >(nPDFA);
 
   // Loop over number of different PDF sets, and thereby projectiles.
   for (int iPA = 0; iPA < nPDFA; ++iPA) {
-    MPIInterpolationInfo& mpiNow = mpis[iPA];
+    MPIInterpolationInfo& mpiNow = (*mpisNew)[iPA];
     is >> mpiNow.nStepSave >> mpiNow.eStepMinSave >> mpiNow.eStepMaxSave
        >> mpiNow.eStepSizeSave;
     int nStepTmp = mpiNow.nStepSave;
@@ -1794,31 +1846,138 @@ bool MultipartonInteractions::loadMPIdata() {
     }
   }
 
-  // Also store it in regular location at fixed or maximal (= eCMsave) energy.
+  // Close file and set up current values.
+  is.close();
+  mpisPtr = mpisNew;
+  useMPIdata();
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Pack initialization data into a flat vector, in the same order as
+// written to file, for sharing between instances.
+
+vector<double> MultipartonInteractions::packMPIdata() const {
+
+  vector<double> data;
+  data.push_back( nPDFA);
+  for (int iPA = 0; iPA < nPDFA; ++iPA) {
+    const MPIInterpolationInfo& mpiNow = (*mpisPtr)[iPA];
+    data.push_back( mpiNow.nStepSave);
+    data.push_back( mpiNow.eStepMinSave);
+    data.push_back( mpiNow.eStepMaxSave);
+    data.push_back( mpiNow.eStepSizeSave);
+    for (int iStep = 0; iStep < mpiNow.nStepSave; ++iStep) {
+      data.push_back( mpiNow.pT0Save[iStep]);
+      data.push_back( mpiNow.pT4dSigmaMaxSave[iStep]);
+      data.push_back( mpiNow.pT4dProbMaxSave[iStep]);
+      data.push_back( mpiNow.sigmaIntSave[iStep]);
+      for (int j = 0; j <= 100; ++j)
+        data.push_back( mpiNow.sudExpPTSave[iStep][j]);
+      data.push_back( mpiNow.zeroIntCorrSave[iStep]);
+      data.push_back( mpiNow.normOverlapSave[iStep]);
+      data.push_back( mpiNow.kNowSave[iStep]);
+      data.push_back( mpiNow.bAvgSave[iStep]);
+      data.push_back( mpiNow.bDivSave[iStep]);
+      data.push_back( mpiNow.probLowBSave[iStep]);
+      data.push_back( mpiNow.fracAhighSave[iStep]);
+      data.push_back( mpiNow.fracBhighSave[iStep]);
+      data.push_back( mpiNow.fracChighSave[iStep]);
+      data.push_back( mpiNow.fracABChighSave[iStep]);
+      data.push_back( mpiNow.cDivSave[iStep]);
+      data.push_back( mpiNow.cMaxSave[iStep]);
+    }
+  }
+  return data;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Unpack initialization data from a flat vector, and set up current values.
+
+bool MultipartonInteractions::unpackMPIdata(const vector<double>& data) {
+
+  // Read number of PDF sets, and check that the size is consistent.
+  int iData = 0;
+  int nData = data.size();
+  if (nData < 1) return false;
+  int nPDFAtmp = int(data[iData++]);
+  shared_ptr<vector<MPIInterpolationInfo> > mpisTmp
+    = make_shared<vector<MPIInterpolationInfo> >(nPDFAtmp);
+  for (int iPA = 0; iPA < nPDFAtmp; ++iPA) {
+    if (iData + 4 > nData) return false;
+    MPIInterpolationInfo& mpiNow = (*mpisTmp)[iPA];
+    mpiNow.nStepSave     = int(data[iData++]);
+    mpiNow.eStepMinSave  = data[iData++];
+    mpiNow.eStepMaxSave  = data[iData++];
+    mpiNow.eStepSizeSave = data[iData++];
+    int nStepTmp = mpiNow.nStepSave;
+    if (nStepTmp < 1 || iData + 117 * nStepTmp > nData) return false;
+    mpiNow.init(nStepTmp);
+    for (int iStep = 0; iStep < nStepTmp; ++iStep) {
+      mpiNow.pT0Save[iStep]          = data[iData++];
+      mpiNow.pT4dSigmaMaxSave[iStep] = data[iData++];
+      mpiNow.pT4dProbMaxSave[iStep]  = data[iData++];
+      mpiNow.sigmaIntSave[iStep]     = data[iData++];
+      for (int j = 0; j <= 100; ++j)
+        mpiNow.sudExpPTSave[iStep][j] = data[iData++];
+      mpiNow.zeroIntCorrSave[iStep]  = data[iData++];
+      mpiNow.normOverlapSave[iStep]  = data[iData++];
+      mpiNow.kNowSave[iStep]         = data[iData++];
+      mpiNow.bAvgSave[iStep]         = data[iData++];
+      mpiNow.bDivSave[iStep]         = data[iData++];
+      mpiNow.probLowBSave[iStep]     = data[iData++];
+      mpiNow.fracAhighSave[iStep]    = data[iData++];
+      mpiNow.fracBhighSave[iStep]    = data[iData++];
+      mpiNow.fracChighSave[iStep]    = data[iData++];
+      mpiNow.fracABChighSave[iStep]  = data[iData++];
+      mpiNow.cDivSave[iStep]         = data[iData++];
+      mpiNow.cMaxSave[iStep]         = data[iData++];
+    }
+  }
+
+  // Store and set up current values.
+  nPDFA = nPDFAtmp;
+  mpisPtr = mpisTmp;
+  useMPIdata();
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up current values from stored initialization data,
+// at fixed or maximal (= eCMsave) energy.
+
+void MultipartonInteractions::useMPIdata() {
+
+  const MPIInterpolationInfo& mpiNow = (*mpisPtr)[0];
   iPDFAsave    = 0;
-  eCMsave      = mpis[0].eStepMaxSave;
-  nStep        = mpis[0].nStepSave;
-  eStepMin     = mpis[0].eStepMinSave;
-  eStepMax     = mpis[0].eStepMaxSave;
-  eStepSize    = mpis[0].eStepSizeSave;
-  pT0          = mpis[0].pT0Save[nStep - 1];
-  pT4dSigmaMax = mpis[0].pT4dSigmaMaxSave[nStep - 1];
-  pT4dProbMax  = mpis[0].pT4dProbMaxSave[nStep - 1];
-  sigmaInt     = mpis[0].sigmaIntSave[nStep - 1];
+  eCMsave      = mpiNow.eStepMaxSave;
+  nStep        = mpiNow.nStepSave;
+  eStepMin     = mpiNow.eStepMinSave;
+  eStepMax     = mpiNow.eStepMaxSave;
+  eStepSize    = mpiNow.eStepSizeSave;
+  pT0          = mpiNow.pT0Save[nStep - 1];
+  pT4dSigmaMax = mpiNow.pT4dSigmaMaxSave[nStep - 1];
+  pT4dProbMax  = mpiNow.pT4dProbMaxSave[nStep - 1];
+  sigmaInt     = mpiNow.sigmaIntSave[nStep - 1];
   for (int j = 0; j <= 100; ++j)
-    sudExpPT[j] = mpis[0].sudExpPTSave[nStep - 1][j];
-  zeroIntCorr  = mpis[0].zeroIntCorrSave[nStep - 1];
-  normOverlap  = mpis[0].normOverlapSave[nStep - 1];
-  kNow         = mpis[0].kNowSave[nStep - 1];
-  bAvg         = mpis[0].bAvgSave[nStep - 1];
-  bDiv         = mpis[0].bDivSave[nStep - 1];
-  probLowB     = mpis[0].probLowBSave[nStep - 1];
-  fracAhigh    = mpis[0].fracAhighSave[nStep - 1];
-  fracBhigh    = mpis[0].fracBhighSave[nStep - 1];
-  fracBhigh    = mpis[0].fracChighSave[nStep - 1];
-  fracABChigh  = mpis[0].fracABChighSave[nStep - 1];
-  cDiv         = mpis[0].cDivSave[nStep - 1];
-  cMax         = mpis[0].cMaxSave[nStep - 1];
+    sudExpPT[j] = mpiNow.sudExpPTSave[nStep - 1][j];
+  zeroIntCorr  = mpiNow.zeroIntCorrSave[nStep - 1];
+  normOverlap  = mpiNow.normOverlapSave[nStep - 1];
+  kNow         = mpiNow.kNowSave[nStep - 1];
+  bAvg         = mpiNow.bAvgSave[nStep - 1];
+  bDiv         = mpiNow.bDivSave[nStep - 1];
+  probLowB     = mpiNow.probLowBSave[nStep - 1];
+  fracAhigh    = mpiNow.fracAhighSave[nStep - 1];
+  fracBhigh    = mpiNow.fracBhighSave[nStep - 1];
+  fracBhigh    = mpiNow.fracChighSave[nStep - 1];
+  fracABChigh  = mpiNow.fracABChighSave[nStep - 1];
+  cDiv         = mpiNow.cDivSave[nStep - 1];
+  cMax         = mpiNow.cMaxSave[nStep - 1];
 
   // Derived pT kinematics combinations and some others.
   pT20         = pT0*pT0;
@@ -1832,9 +1991,6 @@ bool MultipartonInteractions::loadMPIdata() {
   pT2maxmin    = pT2max - pT2min;
   normPi       = 1. / (2. * M_PI);
 
-  // Close file and done.
-  is.close();
-  return true;
 }
 
 //--------------------------------------------------------------------------
@@ -405,17 +405,20 @@ void ParticleDataEntry::initBWmass() {
 
 // Function to give mass of a particle, either at the nominal value
 // or picked according to a (linear or quadratic) Breit-Wigner.
+// Optionally with another random number generator than the standard one.
 
-double ParticleDataEntry::mSel() const {
+double ParticleDataEntry::mSel(Rndm* rndmPtrIn) const {
 
   // Nominal value. (Width check should not be needed, but just in case.)
   if (modeBWnow == 0 || mWidthSave < NARROWMASS) return m0Save;
   double mNow, m2Now;
+  Rndm* rndmPtr = (rndmPtrIn != nullptr) ? rndmPtrIn
+    : particleDataPtr->rndmPtr;
 
   // Mass according to a Breit-Wigner linear in m.
   if (modeBWnow == 1) {
      mNow = m0Save + 0.5 * mWidthSave
-       * tan( atanLow + atanDif * particleDataPtr->rndmPtr->flat() );
+       * tan( atanLow + atanDif * rndmPtr->flat() );
 
   // Ditto, but make Gamma proportional to sqrt(m^2 - m_threshold^2).
   } else if (modeBWnow == 2) {
@@ -423,17 +426,17 @@ double ParticleDataEntry::mSel() const {
     double m0ThrS = m0Save*m0Save - mThr*mThr;
     do {
       mNow = m0Save + 0.5 * mWidthSave
-        * tan( atanLow + atanDif * particleDataPtr->rndmPtr->flat() );
+        * tan( atanLow + atanDif * rndmPtr->flat() );
       mWidthNow = mWidthSave * sqrtpos( (mNow*mNow - mThr*mThr) / m0ThrS );
       fixBW = mWidthSave / (pow2(mNow - m0Save) + pow2(0.5 * mWidthSave));
       runBW = mWidthNow / (pow2(mNow - m0Save) + pow2(0.5 * mWidthNow));
-    } while (runBW < particleDataPtr->rndmPtr->flat()
+    } while (runBW < rndmPtr->flat()
       * particleDataPtr->maxEnhanceBW * fixBW);
 
   // Mass according to a Breit-Wigner quadratic in m.
   } else if (modeBWnow == 3) {
     m2Now = m0Save*m0Save + m0Save * mWidthSave
-      * tan( atanLow + atanDif * particleDataPtr->rndmPtr->flat() );
+      * tan( atanLow + atanDif * rndmPtr->flat() );
     mNow = sqrtpos( m2Now);
 
   // Ditto, but m_0 Gamma_0 -> m Gamma(m) with threshold factor as above.
@@ -444,13 +447,13 @@ double ParticleDataEntry::mSel() const {
     double m2Thr = mThr * mThr;
     do {
       m2Now = m2Ref + mwRef * tan( atanLow + atanDif
-        * particleDataPtr->rndmPtr->flat() );
+        * rndmPtr->flat() );
       mNow = sqrtpos( m2Now);
       mwNow = mNow * mWidthSave
         * sqrtpos( (m2Now - m2Thr) / (m2Ref - m2Thr) );
       fixBW = mwRef / (pow2(m2Now - m2Ref) + pow2(mwRef));
       runBW = mwNow / (pow2(m2Now - m2Ref) + pow2(mwNow));
-    } while (runBW < particleDataPtr->rndmPtr->flat()
+    } while (runBW < rndmPtr->flat()
       * particleDataPtr->maxEnhanceBW * fixBW);
   }
 
@@ -503,27 +506,33 @@ bool ParticleDataEntry::preparePick(int idSgn, double mHat, int idInFlav) {
 
   // Reset sum of allowed widths/branching ratios.
   currentBRSum = 0.;
+  useAliasNow  = false;
 
   // For resonances the widths are calculated dynamically.
   if (isResonanceSave && resonancePtr != nullptr) {
     resonancePtr->widthStore(idSgn, mHat, idInFlav);
     for (int i = 0; i < int(channels.size()); ++i)
       currentBRSum += channels[i].currentBR();
+    iCurrentBR = -1;
+
+  // Else fixed branching ratios, optionally via alias tables. These
+  // are (re)built when absent or when any channel has changed. The
+  // currentBR values are only reset when they depend on the sign.
+  } else if (particleDataPtr->useAliasTables) {
+    iAliasNow = (idSgn > 0) ? 0 : 1;
+    if (!hasAlias[iAliasNow]
+      || nChangeAlias[iAliasNow] != nChangeBR)
+      setAliasTable(iAliasNow);
+    else if (iCurrentBR < 0 || (hasSgnDepBR && iCurrentBR != iAliasNow))
+      setCurrentBR(iAliasNow);
+    currentBRSum = aliasBRSum[iAliasNow];
+    useAliasNow  = true;
 
   // Else use normal fixed branching ratios.
   } else {
-    int onMode;
-    double currentBRNow;
-    for (int i = 0; i < int(channels.size()); ++i) {
-      onMode = channels[i].onMode();
-      currentBRNow = 0.;
-      if ( idSgn > 0 && (onMode == 1 || onMode == 2) )
-        currentBRNow = channels[i].bRatio();
-      else if ( idSgn < 0 && (onMode == 1 || onMode == 3) )
-        currentBRNow = channels[i].bRatio();
-      channels[i].currentBR(currentBRNow);
-      currentBRSum += currentBRNow;
-    }
+    setCurrentBR( (idSgn > 0) ? 0 : 1);
+    for (int i = 0; i < int(channels.size()); ++i)
+      currentBRSum += channels[i].currentBR();
   }
 
   // Failure if no channels found with positive branching ratios.
@@ -537,6 +546,16 @@ bool ParticleDataEntry::preparePick(int idSgn, double mHat, int idInFlav) {
 
 DecayChannel& ParticleDataEntry::pickChannel() {
 
+  // Alias table: pick a slot uniformly, and then either its own channel
+  // or its alias, using the remainder of the same random number.
+  if (useAliasNow && aliasProb[iAliasNow].size() > 0) {
+    int nSlot = aliasProb[iAliasNow].size();
+    double rndmSlot = nSlot * particleDataPtr->rndmPtr->flat();
+    int iSlot = min( int(rndmSlot), nSlot - 1);
+    return channels[ (rndmSlot - iSlot < aliasProb[iAliasNow][iSlot])
+      ? aliasChan[iAliasNow][iSlot] : aliasAlt[iAliasNow][iSlot] ];
+  }
+
   // Find channel in table.
   int size = channels.size();
   double rndmBR = currentBRSum * particleDataPtr->rndmPtr->flat();
@@ -552,6 +571,84 @@ DecayChannel& ParticleDataEntry::pickChannel() {
 
 //--------------------------------------------------------------------------
 
+// Set up the alias table for decays of the particle (iSgn = 0) or the
+// antiparticle (iSgn = 1), following the Walker/Vose method. Only open
+// channels with positive branching ratio are given a slot.
+
+void ParticleDataEntry::setAliasTable(int iSgn) {
+
+  // Find open channels, as in the linear search in preparePick.
+  nChangeAlias[iSgn] = nChangeBR;
+  setCurrentBR(iSgn);
+  vector<int>&    chan = aliasChan[iSgn];
+  vector<int>&    alt  = aliasAlt[iSgn];
+  vector<double>& prob = aliasProb[iSgn];
+  chan.resize(0);
+  prob.resize(0);
+  double sumBR = 0.;
+  for (int i = 0; i < int(channels.size()); ++i) {
+    double currentBRNow = channels[i].currentBR();
+    if (currentBRNow > 0.) {
+      chan.push_back(i);
+      prob.push_back(currentBRNow);
+      sumBR += currentBRNow;
+    }
+  }
+  aliasBRSum[iSgn] = sumBR;
+  hasAlias[iSgn]   = true;
+  alt = chan;
+  if (sumBR <= 0.) return;
+
+  // Split slots into underfull and overfull ones, relative to average.
+  int nSlot = chan.size();
+  vector<int> iSmall, iLarge;
+  for (int iSlot = 0; iSlot < nSlot; ++iSlot) {
+    prob[iSlot] *= nSlot / sumBR;
+    if (prob[iSlot] < 1.) iSmall.push_back(iSlot);
+    else iLarge.push_back(iSlot);
+  }
+
+  // Fill up each underfull slot with an alias from an overfull one.
+  while (!iSmall.empty() && !iLarge.empty()) {
+    int iS = iSmall.back();
+    int iL = iLarge.back();
+    iSmall.pop_back();
+    alt[iS] = chan[iL];
+    prob[iL] -= 1. - prob[iS];
+    if (prob[iL] < 1.) {
+      iLarge.pop_back();
+      iSmall.push_back(iL);
+    }
+  }
+
+  // Remaining slots are full, up to rounding errors.
+  for (int iSlot : iSmall) prob[iSlot] = 1.;
+  for (int iSlot : iLarge) prob[iSlot] = 1.;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set the currentBR values of fixed branching ratios, for the particle
+// (iSgn = 0) or the antiparticle (iSgn = 1), and note whether any of them
+// depends on the sign.
+
+void ParticleDataEntry::setCurrentBR(int iSgn) {
+
+  iCurrentBR  = iSgn;
+  hasSgnDepBR = false;
+  int onModeSgn = (iSgn == 0) ? 2 : 3;
+  for (int i = 0; i < int(channels.size()); ++i) {
+    int onMode = channels[i].onMode();
+    if (onMode == 2 || onMode == 3) hasSgnDepBR = true;
+    channels[i].currentBR( (onMode == 1 || onMode == onModeSgn)
+      ? channels[i].bRatio() : 0.);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Access methods stored in ResonanceWidths. Could have been
 // inline in .h, except for problems with forward declarations.
 
@@ -636,6 +733,9 @@ void ParticleData::initCommon() {
   // Maximum tail enhancement when adding threshold factor to Breit-Wigner.
   maxEnhanceBW    = settingsPtr->parm("ParticleData:maxEnhanceBW");
 
+  // Pick decay channels with fixed branching ratios from alias tables.
+  useAliasTables  = settingsPtr->flag("ParticleData:aliasTables");
+
   // Find initial MSbar masses for five light flavours.
   mQRun[1]        = settingsPtr->parm("ParticleData:mdRun");
   mQRun[2]        = settingsPtr->parm("ParticleData:muRun");
@@ -918,12 +1018,19 @@ bool ParticleData::copyXML(const ParticleData &particleDataIn) {
 
   // First Reset everything.
   pdt.clear();
+  rebuildIndex();
   xmlFileSav.clear();
   readStringHistory.resize(0);
   readStringSubrun.clear();
   isInit = false;
   xmlFileSav=particleDataIn.xmlFileSav;
 
+  // A database read in binary form is copied in the same way.
+  if (xmlFileSav.empty() && !particleDataIn.binarySav.empty()) {
+    istringstream is(particleDataIn.binarySav);
+    return readBinary(is);
+  }
+
   // Process XML file (now stored in memory)
   if (!processXML(true)) return false;
 
@@ -939,7 +1046,9 @@ bool ParticleData::loadXML(istream& is, bool reset) {
   // Normally reset whole database before beginning.
   if (reset) {
     pdt.clear();
+    rebuildIndex();
     xmlFileSav.clear();
+    binarySav.clear();
     readStringHistory.resize(0);
     readStringSubrun.clear();
     isInit = false;
@@ -1094,6 +1203,122 @@ bool ParticleData::processXML(bool reset) {
 
 //--------------------------------------------------------------------------
 
+// Write whole database in binary form, as one block that also is kept
+// in memory after reading it back in. Only the properties given in the
+// XML file are written, and are then processed as for the XML file.
+
+bool ParticleData::writeBinary(ostream& os) {
+
+  // Empty slots, e.g. pdt[0] as created by particleDataEntryPtr(...)
+  // for an unknown code, are skipped.
+  int nEntry = 0;
+  for (auto pdtEntry = pdt.begin(); pdtEntry != pdt.end(); ++pdtEntry)
+    if (pdtEntry->second) ++nEntry;
+  ostringstream block;
+  putBinary(block, nEntry);
+  for (auto pdtEntry = pdt.begin(); pdtEntry != pdt.end(); ++pdtEntry) {
+    if (!pdtEntry->second) continue;
+    particlePtr = pdtEntry->second;
+    putBinary(block, particlePtr->id());
+    putBinary(block, particlePtr->name());
+    putBinary(block, particlePtr->hasAnti() ? particlePtr->name(-1)
+      : string("void"));
+    putBinary(block, particlePtr->spinType());
+    putBinary(block, particlePtr->chargeType());
+    putBinary(block, particlePtr->colType());
+    putBinary(block, particlePtr->m0());
+    putBinary(block, particlePtr->mWidth());
+    putBinary(block, particlePtr->mMin());
+    putBinary(block, particlePtr->mMax());
+    putBinary(block, particlePtr->tau0());
+    putBinary(block, particlePtr->varWidth());
+
+    // Decay channels, with all eight product slots.
+    putBinary(block, particlePtr->sizeChannels());
+    for (int i = 0; i < particlePtr->sizeChannels(); ++i) {
+      const DecayChannel& channel = particlePtr->channel(i);
+      putBinary(block, channel.onMode());
+      putBinary(block, channel.bRatio());
+      putBinary(block, channel.meMode());
+      for (int j = 0; j < 8; ++j) putBinary(block, channel.product(j));
+    }
+  }
+
+  putBinary(os, block.str());
+  return bool(os);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in whole database in binary form, as written by writeBinary(...).
+
+bool ParticleData::readBinary(istream& is) {
+
+  // Reset whole database before beginning, and read in the block.
+  pdt.clear();
+  rebuildIndex();
+  xmlFileSav.clear();
+  readStringHistory.resize(0);
+  readStringSubrun.clear();
+  isInit = false;
+  if (!getBinary(is, binarySav)) {
+    loggerPtr->ERROR_MSG("could not read binary database");
+    return false;
+  }
+  istringstream block(binarySav);
+
+  // Read in particle properties, and store as for the XML file.
+  int nParticles = -1;
+  if (!getBinary(block, nParticles) || nParticles < 0) return false;
+  for (int iParticle = 0; iParticle < nParticles; ++iParticle) {
+    int idTmp, spinTypeTmp, chargeTypeTmp, colTypeTmp, nChannels;
+    string nameTmp, antiNameTmp;
+    double m0Tmp, mWidthTmp, mMinTmp, mMaxTmp, tau0Tmp;
+    bool varWidthTmp;
+    if (!getBinary(block, idTmp) || !getBinary(block, nameTmp)
+      || !getBinary(block, antiNameTmp) || !getBinary(block, spinTypeTmp)
+      || !getBinary(block, chargeTypeTmp) || !getBinary(block, colTypeTmp)
+      || !getBinary(block, m0Tmp) || !getBinary(block, mWidthTmp)
+      || !getBinary(block, mMinTmp) || !getBinary(block, mMaxTmp)
+      || !getBinary(block, tau0Tmp) || !getBinary(block, varWidthTmp)
+      || !getBinary(block, nChannels) || nChannels < 0) {
+      loggerPtr->ERROR_MSG("corrupt binary database");
+      return false;
+    }
+    addParticle( idTmp, nameTmp, antiNameTmp, spinTypeTmp, chargeTypeTmp,
+                 colTypeTmp, m0Tmp, mWidthTmp, mMinTmp, mMaxTmp, tau0Tmp,
+                 varWidthTmp);
+    particlePtr = particleDataEntryPtr(idTmp);
+
+    // Read in decay channels.
+    for (int iChannel = 0; iChannel < nChannels; ++iChannel) {
+      int onMode, meMode, prod[8];
+      double bRatio;
+      bool isOK = getBinary(block, onMode) && getBinary(block, bRatio)
+        && getBinary(block, meMode);
+      for (int j = 0; j < 8; ++j) isOK = isOK && getBinary(block, prod[j]);
+      if (!isOK) {
+        loggerPtr->ERROR_MSG("corrupt binary database");
+        return false;
+      }
+      particlePtr->addChannel(onMode, bRatio, meMode, prod[0], prod[1],
+        prod[2], prod[3], prod[4], prod[5], prod[6], prod[7]);
+    }
+  }
+
+  // All particle data at this stage defines baseline original.
+  for (auto pdtEntry = pdt.begin(); pdtEntry != pdt.end(); ++pdtEntry) {
+    particlePtr = pdtEntry->second; particlePtr->setHasChanged(false);}
+
+  // Done.
+  isInit = true;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Print out complete database in numerical order as an XML file.
 
 void ParticleData::listXML(string outFile) {
@@ -1167,6 +1392,7 @@ bool ParticleData::readFF(istream& is, bool reset) {
   // Normally reset whole database before beginning.
   if (reset) {
     pdt.clear();
+    rebuildIndex();
     readStringHistory.resize(0);
     readStringSubrun.clear();
     isInit = false;
@@ -1768,9 +1994,9 @@ void ParticleData::list(ostream& str, bool changedOnly, bool changedRes) {
   }
 
   // End of loop over database contents.
-  if (changedOnly && nList == 0) cout << "\n no particle data has been "
+  if (changedOnly && nList == 0) str << "\n no particle data has been "
        << "changed from its default value \n";
-  cout << "\n --------  End PYTHIA Particle Data Table  -----------------"
+  str << "\n --------  End PYTHIA Particle Data Table  -----------------"
        << "--------------------------------------------------------------"
        << "----------\n" << endl;
 
@@ -2244,6 +2470,61 @@ int ParticleData::nextId(int idIn) const {
 
 //--------------------------------------------------------------------------
 
+// Rebuild the lookup index from scratch, e.g. after the map was cleared
+// or copied. The size is the smallest power of two at least twice the
+// number of entries, so that probe sequences stay short. Entries that
+// are no longer in the map are retired rather than deleted.
+
+void ParticleData::rebuildIndex() {
+
+  for (int i = 0; i < int(indexIds.size()); ++i) if (indexIds[i] >= 0) {
+    auto pdtEntry = pdt.find(indexIds[i]);
+    if (pdtEntry == pdt.end() || pdtEntry->second != indexEntries[i])
+      retiredEntries.push_back(indexEntries[i]);
+  }
+  int nSlot = 64;
+  indexShift = 26;
+  while (nSlot < 2 * int(pdt.size()) + 2) {
+    nSlot *= 2;
+    --indexShift;
+  }
+  indexIds.assign( nSlot, -1);
+  indexEntries.assign( nSlot, nullptr);
+  nIndexed = 0;
+  for (auto pdtEntry = pdt.begin(); pdtEntry != pdt.end(); ++pdtEntry)
+    if (pdtEntry->second != nullptr) addToIndex( pdtEntry->first);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Add an entry of the map to the lookup index, or update the slot if
+// the id is already indexed. The index is enlarged when half full.
+
+void ParticleData::addToIndex(int idAbs) {
+
+  // Rebuild from the map if the index would become too crowded.
+  if (2 * (nIndexed + 1) > int(indexIds.size())) {
+    rebuildIndex();
+    return;
+  }
+
+  // Find either the current slot of the id or the first free one.
+  auto pdtEntry = pdt.find(idAbs);
+  if (pdtEntry == pdt.end() || pdtEntry->second == nullptr) return;
+  int mask = int(indexIds.size()) - 1;
+  int i    = hashSlot(idAbs);
+  while (indexIds[i] >= 0 && indexIds[i] != idAbs) i = (i + 1) & mask;
+  if (indexIds[i] < 0) ++nIndexed;
+  else if (indexEntries[i] != pdtEntry->second)
+    retiredEntries.push_back(indexEntries[i]);
+  indexIds[i]     = idAbs;
+  indexEntries[i] = pdtEntry->second;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Fractional width associated with open channels of one or two resonances.
 
 double ParticleData::resOpenFrac(int id1In, int id2In, int id3In) {
@@ -2252,15 +2533,15 @@ double ParticleData::resOpenFrac(int id1In, int id2In, int id3In) {
   double answer = 1.;
 
   // First resonance.
-  if ( ParticleDataEntryPtr ptr = findParticle(id1In) )
+  if ( ParticleDataEntry* ptr = findEntry(id1In) )
     answer = ptr->resOpenFrac(id1In);
 
   // Possibly second resonance.
-  if ( ParticleDataEntryPtr ptr = findParticle(id2In) )
+  if ( ParticleDataEntry* ptr = findEntry(id2In) )
     answer *= ptr->resOpenFrac(id2In);
 
   // Possibly third resonance.
-  if ( ParticleDataEntryPtr ptr = findParticle(id3In) )
+  if ( ParticleDataEntry* ptr = findEntry(id3In) )
     answer *= ptr->resOpenFrac(id3In);
 
   // Done.
@@ -217,6 +217,17 @@ double PDF::xf(int id, double x, double Q2) {
 
 //--------------------------------------------------------------------------
 
+// Read out parton density for a batch of (x, Q2) points.
+
+void PDF::xfBatch(int id, const vector<double>& x, const vector<double>& Q2,
+  vector<double>& xfOut) {
+  int nPoint = min( x.size(), Q2.size());
+  xfOut.resize(nPoint);
+  for (int i = 0; i < nPoint; ++i) xfOut[i] = xf( id, x[i], Q2[i]);
+}
+
+//--------------------------------------------------------------------------
+
 // Only valence part of parton densities.
 
 double PDF::xfVal(int id, double x, double Q2) {
@@ -403,6 +414,12 @@ double PDF::xfSea(int id, double x, double Q2) {
 
 //--------------------------------------------------------------------------
 
+// Grids already read, shared between all objects using the same file.
+map<string, weak_ptr<const LHAGrid1::GridData> > LHAGrid1::gridCache;
+mutex LHAGrid1::gridCacheMutex;
+
+//--------------------------------------------------------------------------
+
 // Initialize PDF: select data file and open stream.
 
 void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr) {
@@ -457,17 +474,26 @@ void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr) {
   else if (pdfSet == 115) dataFile = pdfdataPath
     + "GKG18_DPDF_FitB_NLO_0000.dat";
 
-  // Open files from which grids should be read in.
-  ifstream is( dataFile.c_str() );
-  if (!is.good()) {
-    printErr("LHAGrid1::init", "did not find data file", loggerPtr);
-    isSet = false;
-    return;
+  // Reuse grid if already read from the same file, else open file from
+  // which grid should be read in, and store it for later reuse.
+  lock_guard<mutex> lock(gridCacheMutex);
+  shared_ptr<const GridData> gridNow = gridCache[dataFile].lock();
+  if (!gridNow) {
+    ifstream is( dataFile.c_str() );
+    if (!is.good()) {
+      printErr("LHAGrid1::init", "did not find data file", loggerPtr);
+      isSet = false;
+      return;
+    }
+    gridNow = readGrid( is, loggerPtr);
+    is.close();
+    if (!gridNow) {
+      isSet = false;
+      return;
+    }
+    gridCache[dataFile] = gridNow;
   }
-
-  // Initialization with a stream.
-  init( is, loggerPtr);
-  is.close();
+  useGrid( gridNow);
 
 }
 
@@ -484,6 +510,27 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
     return;
   }
 
+  // Read and use the grid.
+  shared_ptr<const GridData> gridNow = readGrid( is, loggerPtr);
+  if (!gridNow) {
+    isSet = false;
+    return;
+  }
+  useGrid( gridNow);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in data grid from stream. Returns null pointer if it fails.
+
+shared_ptr<const LHAGrid1::GridData> LHAGrid1::readGrid(istream& is,
+  Logger* loggerPtr) {
+
+  // Grid data to be filled.
+  shared_ptr<GridData> data = make_shared<GridData>();
+  GridData& grid = *data;
+
   // Some local variables.
   string line;
   vector<string> idlines, pdflines;
@@ -491,36 +538,34 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
   double xNow, qNow, pdfNow;
 
   // Skip lines of header, until ---. Probe for next subgrid in Q space.
-  nqSub = 0;
+  grid.nqSub = 0;
   do getline( is, line);
   while (line.find("---") == string::npos);
   if (!is.good()) {
     printErr("LHAGrid1::init", "could not read data file", loggerPtr);
-    isSet = false;
-    return;
+    return nullptr;
   }
 
   // Read each subgrid.
   while (getline( is, line)) {
-    ++nqSub;
+    ++grid.nqSub;
 
     // Read in x grid; save for first, check it matches for later ones.
     istringstream isx(line);
-    if (nqSub == 1) {
+    if (grid.nqSub == 1) {
       while (isx >> xNow) {
-        xGrid.push_back( xNow);
-        lnxGrid.push_back( log(xNow));
+        grid.xGrid.push_back( xNow);
+        grid.lnxGrid.push_back( log(xNow));
       }
-      nx   = xGrid.size();
-      xMin = xGrid.front();
-      xMax = xGrid.back();
+      grid.nx   = grid.xGrid.size();
+      grid.xMin = grid.xGrid.front();
+      grid.xMax = grid.xGrid.back();
     } else {
       int ixc = -1;
       while (isx >> xNow)
-      if ( abs(log(xNow) - lnxGrid[++ixc]) > 1e-5) {
+      if ( abs(log(xNow) - grid.lnxGrid[++ixc]) > 1e-5) {
         printErr("LHAGrid1::init", "mismatched subgrid x spacing", loggerPtr);
-        isSet = false;
-        return;
+        return nullptr;
       }
     }
 
@@ -530,46 +575,40 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
     nqNow = 0;
     while (isq >> qNow) {
       ++nqNow;
-      qGrid.push_back( qNow);
-      lnqGrid.push_back( log(qNow));
+      grid.qGrid.push_back( qNow);
+      grid.lnqGrid.push_back( log(qNow));
     }
-    if (nqSub > 1) {
-      if (abs(qGrid[nq] / qGrid[nq-1] - 1.) > 1e-5) {
+    if (grid.nqSub > 1) {
+      if (abs(grid.qGrid[grid.nq] / grid.qGrid[grid.nq-1] - 1.) > 1e-5) {
         printErr("LHAGrid1::init", "mismatched subgrid Q borders", loggerPtr);
-        isSet = false;
-        return;
+        return nullptr;
       }
-      qGrid[nq-1] = 0.5 * (qGrid[nq-1] + qGrid[nq]);
-      qGrid[nq]   = qGrid[nq-1];
+      grid.qGrid[grid.nq-1]
+        = 0.5 * (grid.qGrid[grid.nq-1] + grid.qGrid[grid.nq]);
+      grid.qGrid[grid.nq]   = grid.qGrid[grid.nq-1];
     }
-    nq   = qGrid.size();
-    qMin = qGrid.front();
-    qMax = qGrid.back();
-    nqSum.push_back(nq);
-    qDiv.push_back(qMax);
+    grid.nq   = grid.qGrid.size();
+    grid.qMin = grid.qGrid.front();
+    grid.qMax = grid.qGrid.back();
+    grid.nqSum.push_back(grid.nq);
+    grid.qDiv.push_back(grid.qMax);
 
     // Read in and store flavour mapping and pdf data. Separator line.
     getline( is, line);
     idlines.push_back( line);
-    for (int ixq = 0; ixq < nx * nqNow; ++ixq) {
+    for (int ixq = 0; ixq < grid.nx * nqNow; ++ixq) {
       getline( is, line);
       pdflines.push_back( line);
     }
     getline( is, line);
   }
 
-  // Create array big enough to hold (flavour, x, Q) grid.
-  for (int iid = 0; iid < 12; ++iid) {
-    pdfGrid[iid] = new double*[nq];
-    for (int iq = 0; iq < nq; ++iq) {
-      pdfGrid[iid][iq] = new double[nx];
-      for (int ix = 0; ix < nx; ++ix) pdfGrid[iid][iq][ix] = 0.;
-    }
-  }
+  // Create array big enough to hold (x, Q, flavour) grid.
+  grid.pdfGrid.assign( grid.nq * grid.nx * 12, 0.);
 
   // Second pass through the Q subranges.
   int iln = -1;
-  for (int iqSub = 0; iqSub < nqSub; ++iqSub) {
+  for (int iqSub = 0; iqSub < grid.nqSub; ++iqSub) {
     vector<int> idGridMap;
 
     // Study flavour grid and decide flavour mapping.
@@ -585,29 +624,57 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
     int nid = idGridMap.size();
 
     // Read in data grid, line by line.
-    int iq0 = (iqSub == 0) ? 0 : nqSum[iqSub - 1];
-    for (int ix = 0; ix < nx; ++ix)
-    for (int iq = iq0; iq < nqSum[iqSub]; ++iq) {
+    int iq0 = (iqSub == 0) ? 0 : grid.nqSum[iqSub - 1];
+    for (int ix = 0; ix < grid.nx; ++ix)
+    for (int iq = iq0; iq < grid.nqSum[iqSub]; ++iq) {
       istringstream ispdf( pdflines[++iln] );
       for (int iid = 0; iid < nid; ++iid) {
         ispdf >> pdfNow;
-        if (idGridMap[iid] >= 0) pdfGrid[idGridMap[iid]][iq][ix] = pdfNow;
+        if (idGridMap[iid] >= 0)
+          grid.pdfGrid[(iq * grid.nx + ix) * 12 + idGridMap[iid]] = pdfNow;
       }
     }
   }
 
   // For extrapolation to small x: create array for b values of x^b shape.
-  pdfSlope = new double*[12];
+  grid.pdfSlope.assign( grid.nq * 12, 0.);
+  double dlnx = grid.lnxGrid[1] - grid.lnxGrid[0];
+  for (int iq = 0; iq < grid.nq; ++iq)
   for (int iid = 0; iid < 12; ++iid) {
-    pdfSlope[iid] = new double[nq];
-    for (int iq = 0; iq < nq; ++iq) { pdfSlope[iid][iq] =
-      ( min( pdfGrid[iid][iq][0], pdfGrid[iid][iq][1]) > 1e-5
-      && abs(lnxGrid[1] - lnxGrid[0]) > 1e-5)
-      ? ( log(pdfGrid[iid][iq][1]) - log(pdfGrid[iid][iq][0]) )
-      / (lnxGrid[1] - lnxGrid[0]) : 0.;
-    }
+    double pdf0 = grid.pdfGrid[iq * grid.nx * 12 + iid];
+    double pdf1 = grid.pdfGrid[(iq * grid.nx + 1) * 12 + iid];
+    if (min( pdf0, pdf1) > 1e-5 && abs(dlnx) > 1e-5)
+      grid.pdfSlope[iq * 12 + iid] = (log(pdf1) - log(pdf0)) / dlnx;
   }
 
+  // Done.
+  return data;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up to use a data grid, copying the small auxiliary arrays.
+
+void LHAGrid1::useGrid(shared_ptr<const GridData> gridDataPtrIn) {
+
+  gridDataPtr = gridDataPtrIn;
+  nx       = gridDataPtr->nx;
+  nq       = gridDataPtr->nq;
+  nqSub    = gridDataPtr->nqSub;
+  nqSum    = gridDataPtr->nqSum;
+  xMin     = gridDataPtr->xMin;
+  xMax     = gridDataPtr->xMax;
+  qMin     = gridDataPtr->qMin;
+  qMax     = gridDataPtr->qMax;
+  xGrid    = gridDataPtr->xGrid;
+  lnxGrid  = gridDataPtr->lnxGrid;
+  qGrid    = gridDataPtr->qGrid;
+  lnqGrid  = gridDataPtr->lnqGrid;
+  qDiv     = gridDataPtr->qDiv;
+  pdfGrid  = gridDataPtr->pdfGrid.data();
+  pdfSlope = gridDataPtr->pdfSlope.data();
+
 }
 
 //--------------------------------------------------------------------------
@@ -721,27 +788,31 @@ void LHAGrid1::xfxevolve(double x, double Q2) {
   }
 
   // Interpolate between grid elements, normally bicubic, or simpler in ln(q).
+  // All flavours are done together, each (x, Q) point contributing
+  // 12 consecutive values, summed in a local array that the compiler
+  // can keep in vector registers. Same order of operations as for a
+  // single flavour.
+  double sum[12] = {};
   if (inx == 0) {
-    for (int iid = 0; iid < 12; ++iid) {
-      double **ppdf = pdfGrid[iid] + m3q;
-      double sum0 = 0.;
-      for (int i3q = 0; i3q < n3q; ++i3q) {
-        double *pdf = ppdf[i3q] + m3x;
-        sum0 +=  wq[i3q] * (wx[0] * pdf[0] + wx[1] * pdf[1] + wx[2] * pdf[2]
-              + wx[3] * pdf[3] );
-      }
-      pdfVal[iid] = sum0;
+    for (int i3q = 0; i3q < n3q; ++i3q) {
+      const double* pdf = pdfGrid + ((m3q + i3q) * nx + m3x) * 12;
+      double wqNow = wq[i3q];
+      for (int iid = 0; iid < 12; ++iid)
+        sum[iid] += wqNow * (wx[0] * pdf[iid] + wx[1] * pdf[12 + iid]
+          + wx[2] * pdf[24 + iid] + wx[3] * pdf[36 + iid]);
     }
 
   // Special: extrapolate to small x. (Let vanish at large x, so no such code.)
   } else if (inx == -1) {
-    for (int iid = 0; iid < 12; ++iid) {
-      pdfVal[iid] = 0.;
-      for (int i3q = 0; i3q < n3q; ++i3q)
-        pdfVal[iid] += wq[i3q] * pdfGrid[iid][m3q+i3q][0]
-          * (doExtraPol ? pow( x / xMin, pdfSlope[iid][m3q+i3q]) : 1.);
+    for (int i3q = 0; i3q < n3q; ++i3q) {
+      const double* pdf   = pdfGrid + (m3q + i3q) * nx * 12;
+      const double* slope = pdfSlope + (m3q + i3q) * 12;
+      for (int iid = 0; iid < 12; ++iid)
+        sum[iid] += wq[i3q] * pdf[iid]
+          * (doExtraPol ? pow( x / xMin, slope[iid]) : 1.);
     }
   }
+  for (int iid = 0; iid < 12; ++iid) pdfVal[iid] = sum[iid];
 
 }
 
@@ -496,6 +496,10 @@ bool PartonLevel::next( Event& process, Event& event) {
     mergingHooksPtr->storeWeights(infoPtr->weightContainerPtr->
         weightsMerging.weightValues);
 
+  // Reset counters of colour reconnection trials for the event.
+  infoPtr->setCounter(32);
+  infoPtr->setCounter(33);
+
   // Loop to set up diffractive system if run with MPI veto.
   for (int iHardDiffLoop = 1; iHardDiffLoop <= nHardDiffLoop;
     ++iHardDiffLoop) {
@@ -1108,7 +1112,7 @@ bool PartonLevel::next( Event& process, Event& event) {
 
   // Do colour reconnection for non-diffractive events before resonance decays.
   if ( colourReconnectionPtr && !doDiffCR && reconnectMode > 0) {
-    Event eventSave = event;
+    event.saveCheckpoint();
     bool colCorrect = false;
     for (int i = 0; i < 10; ++i) {
       colourReconnectionPtr->next(event, 0);
@@ -1116,8 +1120,9 @@ bool PartonLevel::next( Event& process, Event& event) {
         colCorrect = true;
         break;
       }
-      else event = eventSave;
+      else event.restoreCheckpoint();
     }
+    event.clearCheckpoint();
     if (!colCorrect) {
       loggerPtr->ERROR_MSG("colour reconnection failed");
       return false;
@@ -1153,7 +1158,7 @@ bool PartonLevel::next( Event& process, Event& event) {
   // Do colour reconnection for resonance decays.
   if (!earlyResDec && forceResonanceCR && colourReconnectionPtr &&
       !doDiffCR && reconnectMode != 0) {
-    Event eventSave = event;
+    event.saveCheckpoint();
     bool colCorrect = false;
     for (int i = 0; i < 10; ++i) {
       colourReconnectionPtr->next(event, oldSizeEvt);
@@ -1161,8 +1166,9 @@ bool PartonLevel::next( Event& process, Event& event) {
         colCorrect = true;
         break;
       }
-      else event = eventSave;
+      else event.restoreCheckpoint();
     }
+    event.clearCheckpoint();
     if (!colCorrect) {
       loggerPtr->ERROR_MSG("colour reconnection failed");
       return false;
@@ -12,6 +12,130 @@ namespace Pythia8 {
 
 //==========================================================================
 
+// The AdaptiveGrid class.
+// One-dimensional VEGAS-style grid on the unit interval.
+
+//--------------------------------------------------------------------------
+
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Power used to dampen the adaptation of bins from one step to the next.
+const double AdaptiveGrid::DAMPING = 1.5;
+
+//--------------------------------------------------------------------------
+
+// Set up with bins of equal width.
+
+void AdaptiveGrid::init(int nBinIn) {
+
+  nBin = max( 1, nBinIn);
+  edges.resize( nBin + 1);
+  for (int i = 0; i <= nBin; ++i) edges[i] = double(i) / nBin;
+  sums.assign( nBin, 0.);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Value for a uniform random number: pick bin, then flat inside it.
+
+double AdaptiveGrid::pick(double r) const {
+
+  double rBin = r * nBin;
+  int    iBin = min( nBin - 1, int(rBin));
+  return edges[iBin] + (rBin - iBin) * (edges[iBin + 1] - edges[iBin]);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Probability density at a value, normalized to unit integral.
+
+double AdaptiveGrid::density(double u) const {
+
+  int iBin = bin(u);
+  return 1. / (nBin * (edges[iBin + 1] - edges[iBin]));
+
+}
+
+//--------------------------------------------------------------------------
+
+// Adapt the bins so that each carries the same share of the accumulated
+// weight. The weights are smoothed with those of neighbouring bins and
+// dampened, to avoid large jumps from limited statistics.
+
+void AdaptiveGrid::adapt() {
+
+  // Smoothed and normalized weight of each bin.
+  double sum = 0.;
+  for (int i = 0; i < nBin; ++i) sum += abs(sums[i]);
+  if (sum <= 0.) return;
+  vector<double> imp( nBin, 0.);
+  double impSum = 0.;
+  for (int i = 0; i < nBin; ++i) {
+    int iLow = max( 0, i - 1);
+    int iUpp = min( nBin - 1, i + 1);
+    double frac = (abs(sums[iLow]) + abs(sums[i]) + abs(sums[iUpp]))
+      / (3. * sum);
+
+    // Dampened importance of each bin.
+    if (frac >= 1.) imp[i] = 1.;
+    else if (frac > 0.) imp[i] = pow( (1. - frac) / -log(frac), DAMPING);
+    impSum += imp[i];
+  }
+
+  // Place new edges so that each bin gets the same importance, with
+  // the importance taken to be evenly spread inside each old bin.
+  vector<double> edgesNew( nBin + 1);
+  edgesNew[0]    = 0.;
+  edgesNew[nBin] = 1.;
+  double impBin  = impSum / nBin;
+  double impAcc  = 0.;
+  int    iOld    = 0;
+  for (int i = 1; i < nBin; ++i) {
+    double impNow = i * impBin;
+    while (impAcc + imp[iOld] < impNow) impAcc += imp[iOld++];
+    edgesNew[i] = edges[iOld] + (edges[iOld + 1] - edges[iOld])
+      * (impNow - impAcc) / imp[iOld];
+  }
+
+  // Store new edges and reset accumulated weights.
+  edges.swap( edgesNew);
+  sums.assign( nBin, 0.);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Append the bin edges to a flat vector.
+
+void AdaptiveGrid::getEdges(vector<double>& data) const {
+
+  data.push_back( nBin);
+  data.insert( data.end(), edges.begin(), edges.end());
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read back the bin edges from a flat vector, starting at iData.
+
+bool AdaptiveGrid::setEdges(const vector<double>& data, int& iData) {
+
+  if (iData >= int(data.size())) return false;
+  int nBinIn = int(data[iData++]);
+  if (nBinIn < 1 || iData + nBinIn + 1 > int(data.size())) return false;
+  nBin = nBinIn;
+  edges.assign( data.begin() + iData, data.begin() + iData + nBin + 1);
+  sums.assign( nBin, 0.);
+  iData += nBin + 1;
+  return true;
+
+}
+
+//==========================================================================
+
 // The PhaseSpace class.
 // Base class for phase space generators.
 
@@ -26,6 +150,9 @@ const int    PhaseSpace::NMAXTRY        = 2;
 // Number of three-body trials in phase space optimization.
 const int    PhaseSpace::NTRY3BODY      = 20;
 
+// Number of values stored by getSampling123.
+const int    PhaseSpace::NSAMPLING123   = 63;
+
 // Maximum cross section increase, just in case true maximum not found.
 const double PhaseSpace::SAFETYMARGIN   = 1.05;
 
@@ -200,6 +327,16 @@ void PhaseSpace::init(bool isFirst, SigmaProcessPtr sigmaProcessPtrIn) {
   bias2SelRef      = parm("PhaseSpace:bias2SelectionRef");
   if (canBias2Sel) pTHatGlobalMin = max( pTHatGlobalMin, pTHatMinDiverge);
 
+  // Optional adaptive grids for 2 -> 2 processes.
+  useGrid          = flag("PhaseSpace:adaptiveGrid");
+  nGridBins        = mode("PhaseSpace:adaptiveGridBins");
+  nGridIter        = mode("PhaseSpace:adaptiveGridIterations");
+  nGridPoints      = mode("PhaseSpace:adaptiveGridPoints");
+  gridFracSet      = parm("PhaseSpace:adaptiveGridFraction");
+  gridFrac         = 0.;
+  effNoGrid        = 0.;
+  effGrid          = 0.;
+
   // Default event-specific kinematics properties.
   x1H             = 1.;
   x2H             = 1.;
@@ -986,11 +1123,159 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
 
 //--------------------------------------------------------------------------
 
-// Select a trial kinematics phase space point.
+// Store the outcome of setupSampling123 as a flat vector.
+
+void PhaseSpace::getSampling123(vector<double>& data) const {
+
+  // Resonances in the s-channel.
+  data.clear();
+  data.push_back( nTau);
+  data.push_back( nY);
+  data.push_back( nZ);
+  data.push_back( idResA);
+  data.push_back( idResB);
+  data.push_back( mResA);
+  data.push_back( mResB);
+  data.push_back( GammaResA);
+  data.push_back( GammaResB);
+  data.push_back( tauResA);
+  data.push_back( tauResB);
+  data.push_back( widResA);
+  data.push_back( widResB);
+  data.push_back( sameResMass ? 1. : 0.);
+
+  // Optimized coefficients and the maximum found.
+  for (int i = 0; i < 8; ++i) {
+    data.push_back( tauCoef[i]);
+    data.push_back( yCoef[i]);
+    data.push_back( zCoef[i]);
+    data.push_back( tauCoefSum[i]);
+    data.push_back( yCoefSum[i]);
+    data.push_back( zCoefSum[i]);
+  }
+  data.push_back( sigmaMx);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Restore the outcome of setupSampling123 from a flat vector, starting
+// at iData, instead of searching for it. Returns false if the stored
+// setup does not match.
+
+bool PhaseSpace::setSampling123(bool is2, bool is3,
+  const vector<double>& data, int& iData) {
+
+  // Check that open range in tau (+ set tauMin, tauMax), and that the
+  // data has the expected size.
+  if (!limitTau(is2, is3)) return false;
+  if (iData < 0 || iData + NSAMPLING123 > int(data.size())) return false;
+
+  // Resonances in the s-channel.
+  nTau        = int(data[iData++]);
+  nY          = int(data[iData++]);
+  nZ          = int(data[iData++]);
+  idResA      = int(data[iData++]);
+  idResB      = int(data[iData++]);
+  mResA       = data[iData++];
+  mResB       = data[iData++];
+  GammaResA   = data[iData++];
+  GammaResB   = data[iData++];
+  tauResA     = data[iData++];
+  tauResB     = data[iData++];
+  widResA     = data[iData++];
+  widResB     = data[iData++];
+  sameResMass = (data[iData++] > 0.5);
+
+  // Default z value and weight required for 2 -> 1.
+  z   = 0.;
+  wtZ = 1.;
+
+  // Optimized coefficients and the maximum found.
+  for (int i = 0; i < 8; ++i) {
+    tauCoef[i]    = data[iData++];
+    yCoef[i]      = data[iData++];
+    zCoef[i]      = data[iData++];
+    tauCoefSum[i] = data[iData++];
+    yCoefSum[i]   = data[iData++];
+    zCoefSum[i]   = data[iData++];
+  }
+  sigmaMx  = data[iData++];
+  sigmaPos = sigmaMx;
+  sigmaNeg = 0.;
+
+  // Done.
+  return (sigmaMx > 0.);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Select a trial kinematics phase space point, and check whether the
+// cross section maximum is violated.
+
+bool PhaseSpace::trialKin123(bool is2, bool is3, bool inEvent) {
+
+  // Pick point and find its cross section.
+  if (!trialPoint123(is2, is3, inEvent)) return false;
+
+  // Check if maximum violated.
+  newSigmaMx = false;
+  if (sigmaNw > sigmaMx) {
+    loggerPtr->WARNING_MSG("maximum for cross section violated");
+
+    // Violation strategy 1: increase maximum (always during initialization).
+    if (increaseMaximum || !inEvent) {
+      double violFact = SAFETYMARGIN * sigmaNw / sigmaMx;
+      sigmaMx = SAFETYMARGIN * sigmaNw;
+      newSigmaMx = true;
+      if (showViolation) {
+        if (violFact < 9.99) cout << fixed;
+        else                 cout << scientific;
+        cout << " PYTHIA Maximum for " << sigmaProcessPtr->name()
+             << " increased by factor " << setprecision(3) << violFact
+             << " to " << scientific << sigmaMx << endl;
+      }
+
+    // Violation strategy 2: weight event (done in ProcessContainer).
+    } else if (showViolation && sigmaNw > sigmaPos) {
+      double violFact = sigmaNw / sigmaMx;
+      if (violFact < 9.99) cout << fixed;
+      else                 cout << scientific;
+      cout << " PYTHIA Maximum for " << sigmaProcessPtr->name()
+           << " exceeded by factor " << setprecision(3) << violFact << endl;
+      sigmaPos = sigmaNw;
+    }
+  }
+
+  // Check if negative cross section.
+  if (sigmaNw < sigmaNeg) {
+    loggerPtr->WARNING_MSG("negative cross section set 0",
+      "for " +  sigmaProcessPtr->name() );
+    sigmaNeg = sigmaNw;
+
+    // Optional printout of (all) violations.
+    if (showViolation) cout << " PYTHIA Negative minimum for "
+      << sigmaProcessPtr->name() << " changed to " << scientific
+      << setprecision(3) << sigmaNeg << endl;
+  }
+  if (sigmaNw < 0.) sigmaNw = 0.;
+
+  // Set event weight, where relevant.
+  biasWt = (canBiasSelection) ? userHooksPtr->biasedSelectionWeight() : 1.;
+  if (canBias2Sel) biasWt /= pow( pTH / bias2SelRef, bias2SelPow);
+
+  // Done.
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Select a trial kinematics phase space point and find its cross section.
 // Note: by In is meant the integral over the quantity multiplying
 // coefficient cn. The sum of cn is normalized to unity.
 
-bool PhaseSpace::trialKin123(bool is2, bool is3, bool inEvent) {
+bool PhaseSpace::trialPoint123(bool is2, bool is3, bool inEvent) {
 
   // Allow for possibility that energy varies from event to event.
   if (doEnergySpread) {
@@ -1017,37 +1302,74 @@ bool PhaseSpace::trialKin123(bool is2, bool is3, bool inEvent) {
   // + (c4/I4) / (tau + tauResB)
   // + (c5/I5) * tau / ((tau - tauResB)^2 + widResB^2)
   // + (c6/I6) * tau / (1 - tau).
+  // Optionally instead pick from the adaptive grid in log(tau), and
+  // combine the two densities in the weight.
   if (!limitTau(is2, is3)) return false;
-  int iTau = 0;
-  if (!hasTwoPointParticles) {
-    double rTau = rndmPtr->flat();
-    while (rTau > tauCoefSum[iTau]) ++iTau;
+  bool useGridNow = is2 && gridFrac > 0.;
+  if (useGridNow && rndmPtr->flat() < gridFrac) {
+    uTauGrid = gridTau.pick( rndmPtr->flat());
+    tau = tauMin * pow( tauMax / tauMin, uTauGrid);
+    selectTau( -1, 0., is2);
+  } else {
+    int iTau = 0;
+    if (!hasTwoPointParticles) {
+      double rTau = rndmPtr->flat();
+      while (rTau > tauCoefSum[iTau]) ++iTau;
+    }
+    selectTau( iTau, rndmPtr->flat(), is2);
+    if (useGridNow) uTauGrid = log(tau / tauMin) / intTau0;
   }
-  selectTau( iTau, rndmPtr->flat(), is2);
+  if (useGridNow) wtTau = 1. / ( (1. - gridFrac) / wtTau
+    + gridFrac * gridTau.density(uTauGrid) / intTau0 );
 
   // Choose y according to h2(y), where
   // h2(y) = (c0/I0) * 1/cosh(y)
   // + (c1/I1) * (y-ymin) + (c2/I2) * (ymax-y)
   // + (c3/I3) * exp(y) + (c4/i4) * exp(-y) (for hadron; for lepton instead)
   // + (c5/I5) * 1 / (1 - exp(y-ymax)) + (c6/I6) * 1 / (1 - exp(ymin-y)).
+  // Optionally instead pick from the adaptive grid in y.
   if (!limitY()) return false;
-  int iY = 0;
-  if (!hasOnePointParticle && !hasTwoPointParticles) {
-    double rY = rndmPtr->flat();
-    while (rY > yCoefSum[iY]) ++iY;
+  if (useGridNow && rndmPtr->flat() < gridFrac) {
+    uYGrid = gridY.pick( rndmPtr->flat());
+    y = yMax * (2. * uYGrid - 1.);
+    selectY( -1, 0.);
+  } else {
+    int iY = 0;
+    if (!hasOnePointParticle && !hasTwoPointParticles) {
+      double rY = rndmPtr->flat();
+      while (rY > yCoefSum[iY]) ++iY;
+    }
+    selectY( iY, rndmPtr->flat());
+    if (useGridNow) uYGrid = 0.5 * (y / yMax + 1.);
   }
-  selectY( iY, rndmPtr->flat());
+  if (useGridNow) wtY = 1. / ( (1. - gridFrac) / wtY
+    + gridFrac * gridY.density(uYGrid) / (2. * yMax) );
 
   // Choose z = cos(thetaHat) according to h3(z), where
   // h3(z) = c0/I0 + (c1/I1) * 1/(A - z) + (c2/I2) * 1/(A + z)
   // + (c3/I3) * 1/(A - z)^2 + (c4/I4) * 1/(A + z)^2,
   // where A = 1 + 2*(m3*m4/sH)^2 (= 1 for massless products).
+  // Optionally instead pick from the adaptive grid, which spans the
+  // negative- and positive-z ranges one after the other.
   if (is2) {
     if (!limitZ()) return false;
-    int iZ = 0;
-    double rZ = rndmPtr->flat();
-    while (rZ > zCoefSum[iZ]) ++iZ;
-    selectZ( iZ, rndmPtr->flat());
+    double zLenNeg = zNegMax - zNegMin;
+    double zLenSum = zLenNeg + zPosMax - zPosMin;
+    if (useGridNow && rndmPtr->flat() < gridFrac) {
+      uZGrid = gridZ.pick( rndmPtr->flat());
+      double zLen = uZGrid * zLenSum;
+      z = (zLen < zLenNeg) ? zNegMin + zLen : zPosMin + zLen - zLenNeg;
+      selectZ( -1, 0.);
+    } else {
+      int iZ = 0;
+      double rZ = rndmPtr->flat();
+      while (rZ > zCoefSum[iZ]) ++iZ;
+      selectZ( iZ, rndmPtr->flat());
+      if (useGridNow) uZGrid = (z < 0.) ? (z - zNegMin) / zLenSum
+        : (zLenNeg + z - zPosMin) / zLenSum;
+    }
+    if (useGridNow) wtZ = 1. / ( (1. - gridFrac) / wtZ + gridFrac
+      * gridZ.density(uZGrid) / (zLenSum * mHat * pAbs) );
   }
 
   // 2 -> 1: calculate cross section, weighted by phase-space volume.
@@ -1082,52 +1404,6 @@ bool PhaseSpace::trialKin123(bool is2, bool is3, bool inEvent) {
     sigmaProcessPtr.get(), this, inEvent);
   if (canBias2Sel) sigmaNw *= pow( pTH / bias2SelRef, bias2SelPow);
 
-  // Check if maximum violated.
-  newSigmaMx = false;
-  if (sigmaNw > sigmaMx) {
-    loggerPtr->WARNING_MSG("maximum for cross section violated");
-
-    // Violation strategy 1: increase maximum (always during initialization).
-    if (increaseMaximum || !inEvent) {
-      double violFact = SAFETYMARGIN * sigmaNw / sigmaMx;
-      sigmaMx = SAFETYMARGIN * sigmaNw;
-      newSigmaMx = true;
-      if (showViolation) {
-        if (violFact < 9.99) cout << fixed;
-        else                 cout << scientific;
-        cout << " PYTHIA Maximum for " << sigmaProcessPtr->name()
-             << " increased by factor " << setprecision(3) << violFact
-             << " to " << scientific << sigmaMx << endl;
-      }
-
-    // Violation strategy 2: weight event (done in ProcessContainer).
-    } else if (showViolation && sigmaNw > sigmaPos) {
-      double violFact = sigmaNw / sigmaMx;
-      if (violFact < 9.99) cout << fixed;
-      else                 cout << scientific;
-      cout << " PYTHIA Maximum for " << sigmaProcessPtr->name()
-           << " exceeded by factor " << setprecision(3) << violFact << endl;
-      sigmaPos = sigmaNw;
-    }
-  }
-
-  // Check if negative cross section.
-  if (sigmaNw < sigmaNeg) {
-    loggerPtr->WARNING_MSG("negative cross section set 0",
-      "for " +  sigmaProcessPtr->name() );
-    sigmaNeg = sigmaNw;
-
-    // Optional printout of (all) violations.
-    if (showViolation) cout << " PYTHIA Negative minimum for "
-      << sigmaProcessPtr->name() << " changed to " << scientific
-      << setprecision(3) << sigmaNeg << endl;
-  }
-  if (sigmaNw < 0.) sigmaNw = 0.;
-
-  // Set event weight, where relevant.
-  biasWt = (canBiasSelection) ? userHooksPtr->biasedSelectionWeight() : 1.;
-  if (canBias2Sel) biasWt /= pow( pTH / bias2SelRef, bias2SelPow);
-
   // Done.
   return true;
 }
@@ -1373,17 +1649,18 @@ void PhaseSpace::selectY(int iY, double yVal) {
     ? log( max( LEPTONXMIN, LEPTONXMAX / tau - 1. ) ) : 0.;
   double aLowY = LEPTONXLOGMIN;
 
-  // 1 / cosh(y).
+  // 1 / cosh(y). A negative iY keeps the current y.
   if (iY == 0) y = log( tan( atanMin + (atanMax - atanMin) * yVal ) );
 
   // y - y_min or mirrored y_max - y.
-  else if (iY <= 2) y = yMax * (2. * sqrt(yVal) - 1.);
+  else if (iY == 1 || iY == 2) y = yMax * (2. * sqrt(yVal) - 1.);
 
   // exp(y) or mirrored exp(-y).
-  else if (iY <= 4) y = log( expYMin + (expYMax - expYMin) * yVal );
+  else if (iY == 3 || iY == 4)
+    y = log( expYMin + (expYMax - expYMin) * yVal );
 
   // 1 / (1 - exp(y - y_max)) or mirrored 1 / (1 - exp(y_min - y)).
-  else y = yMax - log1p( exp(aLowY + (aUppY - aLowY) * yVal) );
+  else if (iY > 4) y = yMax - log1p( exp(aLowY + (aUppY - aLowY) * yVal) );
 
   // Mirror two cases.
   if (iY == 2 || iY == 4 || iY == 6) y = -y;
@@ -2088,6 +2365,136 @@ bool PhaseSpace2to2tauyz::trialMasses() {
 
 //--------------------------------------------------------------------------
 
+// Store the outcome of setupSampling, including adaptive grids.
+
+bool PhaseSpace2to2tauyz::getSampling(vector<double>& data) const {
+
+  getSampling123(data);
+  data.push_back( gridFrac);
+  data.push_back( effNoGrid);
+  data.push_back( effGrid);
+  if (gridFrac > 0.) {
+    gridTau.getEdges(data);
+    gridY.getEdges(data);
+    gridZ.getEdges(data);
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Restore the outcome of setupSampling, including adaptive grids.
+
+bool PhaseSpace2to2tauyz::setSampling(const vector<double>& data,
+  int iData) {
+
+  if (!setupMasses()) return false;
+  if (iData < 0 || iData + NSAMPLING123 + 3 > int(data.size())) return false;
+  if (!setSampling123(true, false, data, iData)) return false;
+
+  // Adaptive grids, if used.
+  gridFrac  = data[iData++];
+  effNoGrid = data[iData++];
+  effGrid   = data[iData++];
+  if (gridFrac > 0. && (!gridTau.setEdges(data, iData)
+    || !gridY.setEdges(data, iData) || !gridZ.setEdges(data, iData)))
+    return false;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Train adaptive grids in tau, y and z on the cross section, and use them
+// as extra channels if they give a better unweighting efficiency than
+// the standard sampling alone. Only done when both tau and y vary.
+// The two efficiencies are estimated from the sampled average cross
+// sections, each with the maximum that would be used in the generation.
+// The grids are not retrained during the generation.
+
+bool PhaseSpace2to2tauyz::trainGrid() {
+
+  // Reset. Nothing to do for unresolved beams or no cross section.
+  gridFrac  = 0.;
+  effNoGrid = 0.;
+  effGrid   = 0.;
+  if (hasOnePointParticle || hasTwoPointParticles || sigmaMx <= 0.)
+    return true;
+
+  // Efficiency of the standard sampling, with the standard maximum.
+  double sigmaMaxNow = 0.;
+  double sigmaAvg    = sampleGrid( false, sigmaMaxNow);
+  effNoGrid = sigmaAvg / sigmaMx;
+
+  // Adapt the grids to the cross section in a few iterations.
+  gridTau.init( nGridBins);
+  gridY.init( nGridBins);
+  gridZ.init( nGridBins);
+  gridFrac = gridFracSet;
+  for (int iIter = 0; iIter < nGridIter; ++iIter) {
+    sampleGrid( true, sigmaMaxNow);
+    gridTau.adapt();
+    gridY.adapt();
+    gridZ.adapt();
+  }
+
+  // Efficiency with the frozen grids. The weight of each of the three
+  // mixed channels is at most 1 / (1 - gridFrac) times the standard one,
+  // so the maximum must still cover that of the standard search, scaled
+  // up accordingly, also where the sampled points have missed a peak.
+  sigmaAvg = sampleGrid( false, sigmaMaxNow);
+  double sigmaMxGrid = max( sigmaMaxNow, sigmaMx / pow3(1. - gridFrac));
+  effGrid = sigmaAvg / sigmaMxGrid;
+
+  // Keep the grids only if they improve the efficiency.
+  if (effGrid > effNoGrid) sigmaMx = sigmaMxGrid;
+  else gridFrac = 0.;
+  sigmaPos = sigmaMx;
+
+  // Optional printout.
+  if (showSearch) cout << "\n Adaptive grid efficiency = " << setw(11)
+    << effGrid << " (without: " << setw(11) << effNoGrid << "), "
+    << ((gridFrac > 0.) ? "used" : "not used") << "\n Final maximum = "
+    << setw(11) << sigmaMx << endl;
+
+  // Done.
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Sample trial points with the current grids, optionally accumulating
+// them for adaptation. Returns the average cross section, and the maximum
+// extrapolated from its growth over the second half of the points, as in
+// ProcessContainer::findMaximum, times the safety margin.
+
+double PhaseSpace2to2tauyz::sampleGrid(bool doAdapt, double& sigmaMaxNow) {
+
+  double sigmaSum     = 0.;
+  double sigmaHalfWay = 0.;
+  sigmaMaxNow         = 0.;
+  for (int iPoint = 0; iPoint < nGridPoints; ++iPoint) {
+    if (iPoint == nGridPoints / 2) sigmaHalfWay = sigmaMaxNow;
+    if (!trialMasses() || !trialPoint123(true, false, false)) continue;
+    double sigmaNow = max( 0., sigmaNw);
+    sigmaSum   += sigmaNow;
+    sigmaMaxNow = max( sigmaMaxNow, sigmaNow);
+    if (doAdapt) {
+      gridTau.accumulate( uTauGrid, sigmaNow);
+      gridY.accumulate( uYGrid, sigmaNow);
+      gridZ.accumulate( uZGrid, sigmaNow);
+    }
+  }
+  if (sigmaHalfWay > 0.) sigmaMaxNow *= sigmaMaxNow / sigmaHalfWay;
+  sigmaMaxNow *= SAFETYMARGIN;
+  return sigmaSum / max( 1, nGridPoints);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Construct the four-vector kinematics from the trial values.
 
 bool PhaseSpace2to2tauyz::finalKin() {
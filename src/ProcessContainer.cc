@@ -7,6 +7,8 @@
 // ProcessContainer and SetupContainers classes.
 
 #include "Pythia8/ProcessContainer.h"
+#include "Pythia8/InitCache.h"
+#include <chrono>
 
 // Internal headers for special processes.
 #include "Pythia8/SigmaCompositeness.h"
@@ -215,6 +217,89 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
   sigmaProcessPtr->initProc();
   if (!sigmaProcessPtr->initFlux()) return false;
 
+  // Find maximum, unless the search is left to another instance.
+  isFirstSave = isFirst;
+  separateStreams = flag("Random:separateInitStreams");
+  initLesHouches();
+  return findMaximum(false);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Finish the initialization of a process whose maximum search was left
+// to another instance, by waiting for it, or else doing it here.
+
+bool ProcessContainer::initDeferred() {
+
+  if (!isDeferredSave) return true;
+  return findMaximum(true);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find maximum of differential cross section * phasespace, or take it
+// from the shared initialization cache. Without waiting for others, the
+// search is left to another instance that has already claimed it.
+
+bool ProcessContainer::findMaximum(bool waitForOthers) {
+
+  // Time the search, for the per-process breakdown.
+  auto timeBeg   = std::chrono::steady_clock::now();
+  auto timeSince = [&timeBeg]() { return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - timeBeg).count(); };
+  isDeferredSave = false;
+  initSourceSave = 0;
+  int nFin       = sigmaProcessPtr->nFinal();
+
+  // Key identifying the search, for the cache and own random numbers.
+  ostringstream os;
+  os << "ProcessContainer:" << (isFirstSave ? 1 : 2) << ":" << code() << ":"
+     << name() << ":" << setprecision(10) << infoPtr->eCM();
+  string cacheKey = os.str();
+
+  // Reuse the maximum found by another instance with the same setup,
+  // if available in the shared initialization cache. Else claim the
+  // search, or leave it to the instance that already has.
+  InitCachePtr initCachePtr = infoPtr->initCachePtr;
+  bool useCache = initCachePtr && !isLHA && !isSoftQCD() && !beamHasGamma;
+  bool hasClaim = false;
+  if (useCache) {
+    shared_ptr<const vector<double> > dataPtr = waitForOthers
+      ? initCachePtr->wait(cacheKey) : initCachePtr->get(cacheKey);
+    if (!dataPtr && !waitForOthers) {
+      hasClaim = initCachePtr->claim(cacheKey);
+      if (!hasClaim) {
+        isDeferredSave = true;
+        return true;
+      }
+    }
+    if (dataPtr && dataPtr->size() >= 2) {
+      bool physical = ((*dataPtr)[0] > 0.5);
+      if (physical) {
+        physical = phaseSpacePtr->setSampling( *dataPtr, 2);
+        if (physical) {
+          sigmaMx = (*dataPtr)[1];
+          phaseSpacePtr->setSigmaMax(sigmaMx);
+          sigmaSgn = phaseSpacePtr->sigmaSumSigned();
+        }
+      }
+      if (physical || (*dataPtr)[0] < 0.5) {
+        initSourceSave = waitForOthers ? 2 : 1;
+        initTimeSave   = timeSince();
+        return physical;
+      }
+    }
+  }
+
+  // Optionally use a random-number stream of its own, so that the outcome
+  // does not depend on which instance does the search, or in which order.
+  // The original state is restored on any return from here on.
+  RndmStateGuard rndmGuard( separateStreams ? rndmPtr : nullptr);
+  if (separateStreams)
+    rndmPtr->init( InitCache::seed(cacheKey, infoPtr->seedInitStreams));
+
   // Find maximum of differential cross section * phasespace.
   bool physical       = phaseSpacePtr->setupSampling();
   sigmaMx             = phaseSpacePtr->sigmaMax();
@@ -223,6 +308,11 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
   // Separate signed maximum needed for LHA with negative weight.
   sigmaSgn            = phaseSpacePtr->sigmaSumSigned();
 
+  // Store the sampling setup before it is modified by the trials below.
+  vector<double> sampling;
+  bool canShare = useCache && (!physical
+    || phaseSpacePtr->getSampling(sampling));
+
   // Check maximum by a few events, and extrapolate a further increase.
   if (physical & !isLHA && !isSoftQCD()) {
     int nSample = (nFin < 3) ? N12SAMPLE : N3SAMPLE;
@@ -237,7 +327,27 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
     phaseSpacePtr->setSigmaMax(sigmaMx);
   }
 
-  // Allow Pythia to overwrite incoming beams or parts of Les Houches input.
+  // Make the outcome available to other instances, or give up the claim.
+  if (canShare) {
+    vector<double> data( 1, physical ? 1. : 0.);
+    data.push_back( sigmaMx);
+    data.insert( data.end(), sampling.begin(), sampling.end());
+    initCachePtr->set( cacheKey, data);
+  } else if (hasClaim) initCachePtr->release( cacheKey);
+
+  // Done.
+  initTimeSave = timeSince();
+  return physical;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in settings that allow Pythia to overwrite incoming beams
+// or parts of Les Houches input.
+
+void ProcessContainer::initLesHouches() {
+
   idRenameBeams = mode("LesHouches:idRenameBeams");
   setLifetime   = mode("LesHouches:setLifetime");
   setQuarkMass  = mode("LesHouches:setQuarkMass");
@@ -248,8 +358,6 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
   for (int i = 6; i < 9; ++i) idNewM[i] = 2 * i - 1;
   for (int i = 1; i < 9; ++i) mNewM[i]  = particleDataPtr->m0(idNewM[i]);
 
-  // Done.
-  return physical;
 }
 
 //--------------------------------------------------------------------------
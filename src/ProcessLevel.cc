@@ -200,16 +200,10 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
   }
 
   // Initialize each process.
-  int numberOn = 0;
-  for (int i = 0; i < int(containerPtrs.size()); ++i)
-    if (containerPtrs[i]->init(true, &resonanceDecays, slhaInterfacePtr,
-      &gammaKin))
-      ++numberOn;
+  int numberOn = initContainers( containerPtrs, true);
 
   // Sum maxima for Monte Carlo choice.
-  sigmaMaxSum = 0.;
-  for (int i = 0; i < int(containerPtrs.size()); ++i)
-    sigmaMaxSum += containerPtrs[i]->sigmaMax();
+  sigmaMaxSum = sumSigmaMax( containerPtrs, sigmaMaxCum);
 
   // Option to pick a second hard interaction: repeat as above.
   int number2On = 0;
@@ -219,13 +213,9 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
       loggerPtr->ERROR_MSG("no second hard process switched on");
       return false;
     }
-    for (int i2 = 0; i2 < int(container2Ptrs.size()); ++i2)
-      if (container2Ptrs[i2]->init(false, &resonanceDecays,
-        slhaInterfacePtr, &gammaKin)) ++number2On;
+    number2On = initContainers( container2Ptrs, false);
 
-    sigma2MaxSum = 0.;
-    for (int i2 = 0; i2 < int(container2Ptrs.size()); ++i2)
-      sigma2MaxSum += container2Ptrs[i2]->sigmaMax();
+    sigma2MaxSum = sumSigmaMax( container2Ptrs, sigma2MaxCum);
   }
 
   // Check whether to create event weight from components.
@@ -309,6 +299,9 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
          <<"-------------*" << endl;
   }
 
+  // Optionally print the time spent on each process.
+  if (settings.flag("Init:showProcessTimes")) printInitTimes();
+
   // If sum of maxima vanishes then refuse to do anything.
   if ( numberOn == 0  || sigmaMaxSum <= 0.) {
     loggerPtr->ERROR_MSG("all processes have vanishing cross sections");
@@ -614,6 +607,9 @@ void ProcessLevel::statistics(bool reset) {
        << " *-------  End PYTHIA Event and Cross Section Statistics -----"
        << "-----------------------------------------------------*" << endl;
 
+  // Efficiencies of adaptive phase-space grids, where tried.
+  statisticsGrid();
+
   // Optionally reset statistics contants.
   if (reset) resetStatistics();
 
@@ -621,6 +617,54 @@ void ProcessLevel::statistics(bool reset) {
 
 //--------------------------------------------------------------------------
 
+// Print the unweighting efficiencies of processes that tried adaptive
+// phase-space grids: estimated at init without and with grids, and
+// achieved in the generation so far.
+
+void ProcessLevel::statisticsGrid() {
+
+  // Check that there is something to print.
+  bool hasGrid = false;
+  for (int i = 0; i < int(containerPtrs.size()); ++i)
+    if (containerPtrs[i]->sigmaMax() != 0. && containerPtrs[i]->triedGrid())
+      hasGrid = true;
+  if (!hasGrid) return;
+
+  // Header.
+  cout << "\n *-------  PYTHIA Adaptive Phase-Space Grid Statistics  -----"
+       << "-------------------------*\n"
+       << " |                                                            "
+       << "                         |\n"
+       << " | Subprocess                                    Code |  used  "
+       << "  unweighting efficiency |\n"
+       << " |                                                    |        "
+       << " no grid  grid  achieved |\n"
+       << " |                                                            "
+       << "                         |\n";
+
+  // One line per process that tried grids.
+  for (int i = 0; i < int(containerPtrs.size()); ++i) {
+    ProcessContainer* ptr = containerPtrs[i];
+    if (ptr->sigmaMax() == 0. || !ptr->triedGrid()) continue;
+    double effNow = (ptr->nTried() > 0)
+      ? double(ptr->nSelected()) / ptr->nTried() : 0.;
+    cout << " | " << left << setw(45) << ptr->name() << right << setw(5)
+         << ptr->code() << " | " << setw(5) << (ptr->usesGrid() ? "yes" : "no")
+         << "  " << fixed << setprecision(4) << setw(7)
+         << ptr->efficiencyNoGrid() << setw(7) << ptr->efficiencyGrid()
+         << setw(9) << effNow << " |\n";
+  }
+
+  // Listing finished.
+  cout << " |                                                            "
+       << "                         |\n"
+       << " *-------  End PYTHIA Adaptive Phase-Space Grid Statistics  -"
+       << "-------------------------*" << endl;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Reset statistics on cross sections and number of events.
 
 void ProcessLevel::resetStatistics() {
@@ -635,6 +679,113 @@ void ProcessLevel::resetStatistics() {
 
 //--------------------------------------------------------------------------
 
+// Initialize a set of processes, and return the number switched on.
+// Maximum searches left to other instances sharing the initialization
+// cache are collected at the end, when these are likely to be done.
+
+int ProcessLevel::initContainers( vector<ProcessContainer*>& containers,
+  bool isFirst) {
+
+  vector<bool> isOn( containers.size(), false);
+  for (int i = 0; i < int(containers.size()); ++i)
+    isOn[i] = containers[i]->init( isFirst, &resonanceDecays,
+      slhaInterfacePtr, &gammaKin);
+  int number = 0;
+  for (int i = 0; i < int(containers.size()); ++i) {
+    if (containers[i]->isDeferred()) isOn[i] = containers[i]->initDeferred();
+    if (isOn[i]) ++number;
+  }
+  return number;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Print the time spent on initializing each process, with the most
+// time-consuming first, and where its cross section maximum came from.
+
+void ProcessLevel::printInitTimes() {
+
+  // Header.
+  string blank = " |" + string( 66, ' ') + "|\n";
+  cout << "\n *-------  PYTHIA Process Initialization Times  --------"
+       << "------------*\n" << blank
+       << " | Subprocess" << string( 29, ' ') << "Code |  Time (s) |"
+       << " Source |\n" << blank
+       << " |-----------------------------------------------------------"
+       << "-------|\n" << blank;
+
+  // List processes, and for a second hard process repeat as above.
+  static const string SOURCES[3] = { "found", "cache", "waited" };
+  double timeSum = 0.;
+  for (int iHard = 0; iHard < (doSecondHard ? 2 : 1); ++iHard) {
+    vector<ProcessContainer*>& containers = (iHard == 0) ? containerPtrs
+      : container2Ptrs;
+    if (iHard == 1) cout << blank << " |---------------------------------"
+      << "---------------------------------|\n" << blank;
+    vector< pair<double, int> > order;
+    for (int i = 0; i < int(containers.size()); ++i)
+      order.push_back( make_pair( -containers[i]->initTime(), i) );
+    sort( order.begin(), order.end());
+    for (const pair<double, int>& entry : order) {
+      ProcessContainer* cPtr = containers[entry.second];
+      timeSum += cPtr->initTime();
+      cout << " | " << left << setw(38) << cPtr->name().substr(0, 38)
+           << right << setw(5) << cPtr->code() << " | " << scientific
+           << setprecision(3) << setw(9) << cPtr->initTime() << " | "
+           << left << setw(6) << SOURCES[cPtr->initSource()] << right
+           << " |\n";
+    }
+  }
+
+  // Total and end of listing.
+  cout << blank << " | " << left << setw(43) << "Total" << right << " | "
+       << scientific << setprecision(3) << setw(9) << timeSum << " |       "
+       << " |\n" << blank
+       << " *-------  End PYTHIA Process Initialization Times  -------"
+       << "---------*" << endl;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Sum up the cross section maxima of a set of processes, and store the
+// cumulative sums used to pick one of them. Optionally first update the
+// maxima for a switched beam or energy.
+
+double ProcessLevel::sumSigmaMax( vector<ProcessContainer*>& containers,
+  vector<double>& sigmaCum, bool doSwitch) {
+
+  double sigmaSum = 0.;
+  sigmaCum.resize( containers.size());
+  for (int i = 0; i < int(containers.size()); ++i) {
+    sigmaSum += (doSwitch) ? containers[i]->sigmaMaxSwitch()
+                           : containers[i]->sigmaMax();
+    sigmaCum[i] = sigmaSum;
+  }
+  return sigmaSum;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Pick a process according to the cumulative cross section maxima, by a
+// binary search for the first process where the sum reaches the random
+// fraction. This is the same choice as a linear scan over the processes,
+// but scales better when many processes are switched on.
+
+int ProcessLevel::pickContainer( const vector<double>& sigmaCum,
+  double sigmaSum) {
+
+  double sigmaMaxNow = sigmaSum * rndmPtr->flat();
+  int iPick = lower_bound( sigmaCum.begin(), sigmaCum.end(), sigmaMaxNow)
+            - sigmaCum.begin();
+  return min( iPick, int(sigmaCum.size()) - 1);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Generate the next event with one interaction.
 
 bool ProcessLevel::nextOne( Event& process) {
@@ -650,10 +801,7 @@ bool ProcessLevel::nextOne( Event& process) {
 
   // New cross section values needed if switched id or updated energy.
   if (switchedID || switchedEcm) {
-    sigmaMaxSum = 0.;
-    for (int i = 0; i < int(containerPtrs.size()); ++i) {
-      sigmaMaxSum += containerPtrs[i]->sigmaMaxSwitch();
-    }
+    sigmaMaxSum = sumSigmaMax( containerPtrs, sigmaMaxCum, true);
     switchedID  = false;
     switchedEcm = false;
   }
@@ -669,11 +817,7 @@ bool ProcessLevel::nextOne( Event& process) {
 
       // Pick one of the subprocesses.
       if (procType == 0) {
-        double sigmaMaxNow = sigmaMaxSum * rndmPtr->flat();
-        int iMax = containerPtrs.size() - 1;
-        iContainer = -1;
-        do sigmaMaxNow -= containerPtrs[++iContainer]->sigmaMax();
-        while (sigmaMaxNow > 0. && iContainer < iMax);
+        iContainer = pickContainer( sigmaMaxCum, sigmaMaxSum);
 
       // Special forced subprocess. Only for variable-energy SoftQCD.
       } else {
@@ -695,11 +839,8 @@ bool ProcessLevel::nextOne( Event& process) {
     }
 
     // Update sum of maxima if current maximum violated.
-    if (containerPtrs[iContainer]->newSigmaMax()) {
-      sigmaMaxSum = 0.;
-      for (int i = 0; i < int(containerPtrs.size()); ++i)
-        sigmaMaxSum += containerPtrs[i]->sigmaMax();
-    }
+    if (containerPtrs[iContainer]->newSigmaMax())
+      sigmaMaxSum = sumSigmaMax( containerPtrs, sigmaMaxCum);
 
     // Construct kinematics of acceptable process.
     containerPtrs[iContainer]->constructState();
@@ -788,11 +929,7 @@ bool ProcessLevel::nextTwo( Event& process) {
       for ( ; ; ) {
 
         // Pick one of the subprocesses.
-        double sigmaMaxNow = sigmaMaxSum * rndmPtr->flat();
-        int iMax = containerPtrs.size() - 1;
-        iContainer = -1;
-        do sigmaMaxNow -= containerPtrs[++iContainer]->sigmaMax();
-        while (sigmaMaxNow > 0. && iContainer < iMax);
+        iContainer = pickContainer( sigmaMaxCum, sigmaMaxSum);
 
         // Do a trial event of this subprocess; accept or not.
         if (containerPtrs[iContainer]->trialProcess()) break;
@@ -802,33 +939,23 @@ bool ProcessLevel::nextTwo( Event& process) {
       }
 
       // Update sum of maxima if current maximum violated. Event weight.
-      if (containerPtrs[iContainer]->newSigmaMax()) {
-        sigmaMaxSum = 0.;
-        for (int i = 0; i < int(containerPtrs.size()); ++i)
-          sigmaMaxSum += containerPtrs[i]->sigmaMax();
-      }
+      if (containerPtrs[iContainer]->newSigmaMax())
+        sigmaMaxSum = sumSigmaMax( containerPtrs, sigmaMaxCum);
       wtViol1 = (doWt2) ? infoPtr->weight() : 1.;
 
       // Loop internally over tries for second hardest process until succeeds.
       for ( ; ; ) {
 
         // Pick one of the subprocesses.
-        double sigma2MaxNow = sigma2MaxSum * rndmPtr->flat();
-        int i2Max = container2Ptrs.size() - 1;
-        i2Container = -1;
-        do sigma2MaxNow -= container2Ptrs[++i2Container]->sigmaMax();
-        while (sigma2MaxNow > 0. && i2Container < i2Max);
+        i2Container = pickContainer( sigma2MaxCum, sigma2MaxSum);
 
         // Do a trial event of this subprocess; accept or not.
         if (container2Ptrs[i2Container]->trialProcess()) break;
       }
 
       // Update sum of maxima if current maximum violated.
-      if (container2Ptrs[i2Container]->newSigmaMax()) {
-        sigma2MaxSum = 0.;
-        for (int i2 = 0; i2 < int(container2Ptrs.size()); ++i2)
-          sigma2MaxSum += container2Ptrs[i2]->sigmaMax();
-      }
+      if (container2Ptrs[i2Container]->newSigmaMax())
+        sigma2MaxSum = sumSigmaMax( container2Ptrs, sigma2MaxCum);
       wtViol2 = (doWt2) ? infoPtr->weight() : 1.;
 
       // Pick incoming flavours (etc), needed for PDF reweighting.
@@ -1823,6 +1950,9 @@ void ProcessLevel::statistics2(bool reset) {
        << " *-------  End PYTHIA Event and Cross Section Statistics -----"
        << "------------------------------------------------*" << endl;
 
+  // Efficiencies of adaptive phase-space grids, where tried.
+  statisticsGrid();
+
   // Optionally reset statistics contants.
   if (reset) resetStatistics();
 
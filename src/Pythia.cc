@@ -13,6 +13,10 @@
 #include "Pythia8/StringInteractions.h"
 #include "Pythia8/Vincia.h"
 #include "Pythia8/Plugins.h"
+#include <chrono>
+
+// Access file properties, to check that the database is up to date.
+#include <sys/stat.h>
 
 namespace Pythia8 {
 
@@ -26,6 +30,13 @@ namespace Pythia8 {
 const double Pythia::VERSIONNUMBERHEAD = PYTHIA_VERSION;
 const double Pythia::VERSIONNUMBERCODE = 8.312;
 
+// Name and identifier of the binary settings and particle data database.
+const string Pythia::DATABASEFILE = "PythiaDatabase.bin";
+const string Pythia::DATABASETAG  = "PYTHIA8DATABASE";
+
+// Format version of the database. Increase when the layout is changed.
+const int    Pythia::DATABASEVERSION = 1;
+
 //--------------------------------------------------------------------------
 
 // Constructor.
@@ -50,10 +61,15 @@ Pythia::Pythia(string xmlDir, bool printBanner) {
   if (xmlPath.empty() || (xmlPath.length() && xmlPath[xmlPath.length() - 1]
       != '/')) xmlPath += "/";
 
-  // Read in files with all flags, modes, parms and words.
+  // Read in all flags, modes, parms and words, and all particle data,
+  // from the binary database, if it is up to date.
   settings.initPtrs(&logger);
+  particleData.initPtrs( &infoPrivate);
+  bool hasDatabase = readDatabase(xmlPath + DATABASEFILE);
+
+  // Else read in files with all flags, modes, parms and words.
   string initFile = xmlPath + "Index.xml";
-  isConstructed = settings.init( initFile);
+  isConstructed = hasDatabase || settings.init( initFile);
   if (!isConstructed) {
     logger.ABORT_MSG("settings unavailable");
     return;
@@ -69,9 +85,8 @@ Pythia::Pythia(string xmlDir, bool printBanner) {
   if (!checkVersion()) return;
 
   // Read in files with all particle data.
-  particleData.initPtrs( &infoPrivate);
   string dataFile = xmlPath + "ParticleData.xml";
-  isConstructed = particleData.init( dataFile);
+  isConstructed = hasDatabase || particleData.init( dataFile);
   if (!isConstructed) {
     logger.ABORT_MSG("particle data unavailable");
     return;
@@ -318,8 +333,9 @@ void Pythia::initPlugins() {
     objLast = objType;
   }
 
-  // Set the PDF pointers.
-  setPDFPtr(pdfs["A"], pdfs["B"], pdfs["HardA"], pdfs["HardB"],
+  // Set the PDF pointers. PDF plugins are identified by the Init:plugins
+  // setting, so do not count as user PDFs.
+  beamSetup.setPDFPtr(pdfs["A"], pdfs["B"], pdfs["HardA"], pdfs["HardB"],
     pdfs["PomA"], pdfs["PomB"], pdfs["GamA"], pdfs["GamB"],
     pdfs["HardGamA"], pdfs["HardGamB"], pdfs["UnresA"], pdfs["UnresB"],
     pdfs["UnresGamA"], pdfs["UnresGamB"], pdfs["VMDA"], pdfs["VMDB"]);
@@ -328,6 +344,176 @@ void Pythia::initPlugins() {
 
 //--------------------------------------------------------------------------
 
+// Configuration string identifying the setup, for the on-disk cache of
+// initialization products: the code version, all changed settings, all
+// changed particle data and the contents of an SLHA file. Settings that
+// do not affect the initialization products, such as random number seeds
+// and printout options, are left out, so that e.g. grid jobs with
+// different seeds share the same file.
+
+string Pythia::initCacheConfig() {
+
+  static const string skipPrefix[7] = { "random:", "parallelism:", "print:",
+    "init:show", "init:cachedir", "next:", "main:" };
+  ostringstream settingsStream, particleStream;
+  settings.writeFile(settingsStream, false);
+  particleData.list(particleStream, true, false);
+
+  // Keep the changed settings, except those that have no influence.
+  string config = "", line;
+  istringstream is(settingsStream.str());
+  while (getline(is, line)) {
+    string lineLow = toLower(line);
+    bool skip = false;
+    for (int i = 0; i < 7; ++i)
+      if (lineLow.find(skipPrefix[i]) == 0) skip = true;
+    if (!skip) config += line + "\n";
+  }
+  config += particleStream.str();
+
+  // An SLHA file may be changed without changing its name.
+  string slhaFile = word("SLHA:file");
+  if (mode("SLHA:readFrom") > 0 && slhaFile != "void" && slhaFile != "none"
+    && slhaFile != "" && slhaFile != " ") {
+    ifstream slhaStream(slhaFile);
+    ostringstream slhaContents;
+    if (slhaStream.good()) slhaContents << slhaStream.rdbuf();
+    config += "SLHA file:\n" + slhaContents.str();
+  }
+  return config;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Reason why the setup cannot be identified by its configuration string:
+// user objects that may change cross sections or their maxima, which are
+// not described by any settings. Empty if there is none.
+
+string Pythia::initCacheUserObjects() {
+
+  if (userHooksPtr && (userHooksPtr->canModifySigma()
+    || userHooksPtr->canBiasSelection()))
+    return "user hooks that modify cross sections";
+  if (sigmaPtrs.size() > 0) return "user-defined processes";
+  if (resonancePtrs.size() > 0) return "user-defined resonances";
+  if (hasUserPDFPtrs) return "user-defined PDFs";
+  return "";
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write the settings and particle data databases in binary form. They
+// are read anew from the XML files, so that the current ones, with any
+// changes and additions, are not affected. The file starts with a list
+// of the XML files, with size and modification time, so that changes
+// to these can be detected.
+
+bool Pythia::writeDatabase(string fileName) {
+
+  if (!isConstructed) return false;
+  if (fileName == "") fileName = xmlPath + DATABASEFILE;
+  Settings settingsXML;
+  settingsXML.initPtrs(&logger);
+  ParticleData particleDataXML;
+  particleDataXML.initPtrs(&infoPrivate);
+  if (!settingsXML.init(xmlPath + "Index.xml")
+    || !particleDataXML.init(xmlPath + "ParticleData.xml")) {
+    logger.ERROR_MSG("could not read XML files");
+    return false;
+  }
+
+  // List of XML files, relative to the xmldoc directory where possible.
+  vector<string> files = settingsXML.initFiles();
+  files.push_back(xmlPath + "ParticleData.xml");
+  vector<string> names;
+  vector<long long> sizes, times;
+  for (const string& file : files) {
+    struct stat fileStat;
+    if (::stat(file.c_str(), &fileStat) != 0) {
+      logger.ERROR_MSG("could not find file", file);
+      return false;
+    }
+    names.push_back( file.find(xmlPath) == 0 ? file.substr(xmlPath.size())
+      : file);
+    sizes.push_back(fileStat.st_size);
+    times.push_back(fileStat.st_mtime);
+  }
+
+  // Write header, file list and the two databases. Done to a temporary
+  // file that is then renamed, so that a failed or interrupted write,
+  // e.g. on a full disk, does not leave a truncated database behind.
+  string tmpName = fileName + ".tmp" + InitCache::hash( to_string(
+    std::chrono::high_resolution_clock::now().time_since_epoch().count()) );
+  ofstream os(tmpName.c_str(), ios::binary);
+  if (!os.good()) {
+    logger.ERROR_MSG("could not open file", tmpName);
+    return false;
+  }
+  putBinary(os, DATABASETAG);
+  putBinary(os, DATABASEVERSION);
+  putBinary(os, VERSIONNUMBERCODE);
+  putBinary(os, names);
+  putBinary(os, sizes);
+  putBinary(os, times);
+  bool written = settingsXML.writeBinary(os)
+    && particleDataXML.writeBinary(os);
+  os.close();
+  if (!written || !os) {
+    remove(tmpName.c_str());
+    logger.ERROR_MSG("could not write database", fileName);
+    return false;
+  }
+  if (rename(tmpName.c_str(), fileName.c_str()) != 0) {
+    remove(tmpName.c_str());
+    logger.ERROR_MSG("could not rename database to", fileName);
+    return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in the settings and particle data databases in binary form.
+// Nothing is read unless the code version agrees and all the XML files
+// are unchanged since the database was written.
+
+bool Pythia::readDatabase(string fileName) {
+
+  // Check header.
+  ifstream is(fileName.c_str(), ios::binary);
+  if (!is.good()) return false;
+  string tag;
+  int version = 0;
+  double versionNumber = 0.;
+  if (!getBinary(is, tag, 100) || tag != DATABASETAG
+    || !getBinary(is, version) || version != DATABASEVERSION
+    || !getBinary(is, versionNumber) || versionNumber != VERSIONNUMBERCODE)
+    return false;
+
+  // Check that the XML files have not been changed.
+  vector<string> names;
+  vector<long long> sizes, times;
+  if (!getBinary(is, names) || !getBinary(is, sizes)
+    || !getBinary(is, times) || sizes.size() != names.size()
+    || times.size() != names.size()) return false;
+  for (int i = 0; i < int(names.size()); ++i) {
+    string file = (names[i].size() > 0 && names[i][0] == '/') ? names[i]
+      : xmlPath + names[i];
+    struct stat fileStat;
+    if (::stat(file.c_str(), &fileStat) != 0 || fileStat.st_size != sizes[i]
+      || fileStat.st_mtime != times[i]) return false;
+  }
+
+  // Read in the databases.
+  return settings.readBinary(is) && particleData.initBinary(is);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Check for consistency of version numbers (called by constructors).
 
 bool Pythia::checkVersion() {
@@ -544,6 +730,41 @@ bool Pythia::init() {
   if ( flag("Random:setSeed") ) rndm.init( mode("Random:seed") );
   else                          rndm.init(Rndm::DEFAULTSEED);
 
+  // Base seed for initialization steps with random-number streams of their
+  // own. In PythiaParallel the seed of the first instance, so that all
+  // instances use the same streams.
+  vector<int> seedsParallel = settings.mvec("Parallelism:seeds");
+  if (mode("Parallelism:index") >= 0 && seedsParallel.size() > 0)
+    infoPrivate.seedInitStreams = seedsParallel[0];
+  else infoPrivate.seedInitStreams = flag("Random:setSeed")
+    ? mode("Random:seed") : Rndm::DEFAULTSEED;
+
+  // Optionally read in initialization products stored on disk by an
+  // earlier run with the same setup.
+  string initCacheDir  = word("Init:cacheDir");
+  string initCacheFile = "", initCacheConfigNow = "";
+  long   nInitStored   = 0;
+  string userObjects   = (initCacheDir != "" && initCacheDir != "void")
+    ? initCacheUserObjects() : "";
+  if (userObjects != "") logger.WARNING_MSG(
+    "initialization products not cached on disk, due to", userObjects);
+  else if (initCacheDir != "" && initCacheDir != "void") {
+    if (!infoPrivate.initCachePtr || hasOwnInitCache) {
+      infoPrivate.initCachePtr = make_shared<InitCache>();
+      hasOwnInitCache = true;
+    }
+    // The configuration is taken before any setting is changed by the
+    // initialization itself, and reused when writing the file.
+    initCacheConfigNow = initCacheConfig();
+    initCacheFile = initCacheDir + "/pythia-init-"
+      + InitCache::hash(initCacheConfigNow) + ".dat";
+    int nBefore = infoPrivate.initCachePtr->size();
+    if (infoPrivate.initCachePtr->readFile(initCacheFile, initCacheConfigNow)
+      && infoPrivate.initCachePtr->size() > nBefore)
+      logger.INFO_MSG("read initialization products from", initCacheFile);
+    nInitStored = infoPrivate.initCachePtr->nStored();
+  }
+
   // Count up number of initializations.
   infoPrivate.addCounter(1);
 
@@ -973,6 +1194,14 @@ bool Pythia::init() {
   if ( doReconnect ) colourReconnectionPtr =
     stringInteractionsPtr->getColourReconnections();
 
+  // Save new initialization products to disk, if requested.
+  if (initCacheFile != ""
+    && infoPrivate.initCachePtr->nStored() > nInitStored
+    && !infoPrivate.initCachePtr->writeFile(initCacheFile,
+      initCacheConfigNow))
+    logger.WARNING_MSG("could not write initialization products to",
+      initCacheFile);
+
   // Succeeded.
   isInit = true;
   infoPrivate.addCounter(2);
@@ -1556,6 +1785,8 @@ bool Pythia::forceHadronLevel(bool findJunctions) {
 
   // Allow for CR before the hadronization.
   if (forceHadronLevelCR) {
+    infoPrivate.setCounter(32);
+    infoPrivate.setCounter(33);
 
     // Setup parton system for SK-I and SK-II colour reconnection.
     // Require all final state particles to have the Ws as mothers.
@@ -1574,8 +1805,8 @@ bool Pythia::forceHadronLevel(bool findJunctions) {
       }
     }
 
-    // save spare copy of event in case of failure.
-    Event spareEvent = event;
+    // Save checkpoint of event in case of failure.
+    event.saveCheckpoint();
     bool colCorrect = false;
 
     // Allow up to ten tries for CR.
@@ -1586,8 +1817,9 @@ bool Pythia::forceHadronLevel(bool findJunctions) {
         colCorrect = true;
         break;
       }
-      else event = spareEvent;
+      else event.restoreCheckpoint();
     }
+    event.clearCheckpoint();
 
     if (!colCorrect) {
       logger.ERROR_MSG("colour reconnection failed");
@@ -1595,8 +1827,8 @@ bool Pythia::forceHadronLevel(bool findJunctions) {
     }
   }
 
-  // Save spare copy of event in case of failure.
-  Event spareEvent = event;
+  // Save checkpoint of event in case of failure.
+  event.saveCheckpoint();
 
   // Allow up to ten tries for hadron-level processing.
   bool physical = true;
@@ -1629,8 +1861,9 @@ bool Pythia::forceHadronLevel(bool findJunctions) {
     // If failure then warn, restore original configuration and try again.
     logger.WARNING_MSG("hadronLevel failed; try again");
     physical = false;
-    event    = spareEvent;
+    event.restoreCheckpoint();
   }
+  event.clearCheckpoint();
 
   // Done for simpler option.
   if (!physical)  {
@@ -7,6 +7,8 @@
 // PythiaParallel class.
 
 #include "Pythia8/PythiaParallel.h"
+#include <chrono>
+#include <condition_variable>
 
 namespace Pythia8 {
 
@@ -16,6 +18,17 @@ namespace Pythia8 {
 
 //--------------------------------------------------------------------------
 
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Histogram of event generation times: lower edge (in seconds), number of
+// bins per decade and total number of bins, i.e. nine decades.
+const double PythiaParallel::TIMEMIN     = 1e-6;
+const int    PythiaParallel::NTIMEDECADE = 20;
+const int    PythiaParallel::NTIMEBIN    = 180;
+
+//--------------------------------------------------------------------------
+
 // Contructor.
 
 PythiaParallel::PythiaParallel(string xmlDir, bool printBanner)
@@ -82,12 +95,25 @@ bool PythiaParallel::init(function<bool(Pythia*)> customInit) {
   processAsync = settings.flag("Parallelism:processAsync");
   balanceLoad  = settings.flag("Parallelism:balanceLoad");
   doNext       = settings.flag("Parallelism:doNext");
+  chunkSize    = settings.mode("Parallelism:chunkSize");
+  numConsumers = settings.mode("Parallelism:numConsumers");
 
   if (!doNext && !processAsync) {
     logger.WARNING_MSG(
       "setting both doNext and processAsync to off prevents parallelism");
   }
 
+  // Consumer threads are started in addition to the numThreads threads
+  // that generate events.
+  if (processAsync) numConsumers = 0;
+  else if (numConsumers > 0) {
+    logger.INFO_MSG("numbers of generating and consumer threads",
+      to_string(numThreads) + " + " + to_string(numConsumers));
+    if (hardwareThreads > 0 && numThreads + numConsumers > hardwareThreads)
+      logger.WARNING_MSG("numThreads + numConsumers is larger than "
+        "hardware_concurrency", to_string(hardwareThreads));
+  }
+
   // Set seeds.
   vector<int> seeds = settings.mvec("Parallelism:seeds");
   if (seeds.size() == 0) {
@@ -102,31 +128,70 @@ bool PythiaParallel::init(function<bool(Pythia*)> customInit) {
     settings.mvec("Parallelism:seeds", seeds);
   }
 
+  // Optionally share initialization products between the instances.
+  // Only instances with the same setup after customInit share a store,
+  // and instances with user objects not described by the setup, such as
+  // user hooks that modify cross sections, get a store of their own.
+  bool shareInit = settings.flag("Parallelism:shareInit");
+  map<string, InitCachePtr> initCaches;
+  mutex initCacheMutex;
+
   // Create instances in parallel.
   pythiaObjects = vector<unique_ptr<Pythia>>(numThreads);
-
-  vector<thread> initThreads;
   bool initSuccess = true;
 
-  for (int iPythia = 0; iPythia < numThreads; iPythia += 1) {
-    initThreads.emplace_back([=, &seeds, &initSuccess]() {
-      Pythia* pythiaPtr = new Pythia(settings, particleData, false);
-      pythiaObjects[iPythia] = unique_ptr<Pythia>(pythiaPtr);
-      pythiaObjects[iPythia]->settings.flag("Print:quiet", true);
-      pythiaObjects[iPythia]->settings.flag("Random:setSeed", true);
-      pythiaObjects[iPythia]->settings.mode("Random:seed", seeds[iPythia]);
-      pythiaObjects[iPythia]->settings.mode("Parallelism:index", iPythia);
-
-      if (customInit && !customInit(pythiaObjects[iPythia].get()))
-        initSuccess = false;
-      if (!pythiaObjects[iPythia]->init())
-        initSuccess = false;
-    });
+  auto initInstance = [=, &seeds, &initSuccess, &initCaches,
+    &initCacheMutex](int iPythia) {
+    Pythia* pythiaPtr = new Pythia(settings, particleData, false);
+    pythiaObjects[iPythia] = unique_ptr<Pythia>(pythiaPtr);
+    pythiaObjects[iPythia]->settings.flag("Print:quiet", true);
+    pythiaObjects[iPythia]->settings.flag("Random:setSeed", true);
+    pythiaObjects[iPythia]->settings.mode("Random:seed", seeds[iPythia]);
+    pythiaObjects[iPythia]->settings.mode("Parallelism:index", iPythia);
+
+    if (customInit && !customInit(pythiaObjects[iPythia].get()))
+      initSuccess = false;
+    if (shareInit) {
+      string setup = (pythiaPtr->initCacheUserObjects() == "")
+        ? pythiaPtr->initCacheConfig() : "instance " + to_string(iPythia);
+      const std::lock_guard<mutex> lock(initCacheMutex);
+      InitCachePtr& initCachePtr = initCaches[setup];
+      if (!initCachePtr) initCachePtr = make_shared<InitCache>();
+      pythiaPtr->setInitCachePtr(initCachePtr);
+    }
+    if (!pythiaObjects[iPythia]->init())
+      initSuccess = false;
+  };
+
+  // When sharing, the first instance fills the cache before the others
+  // start, so that they can read from it rather than repeat the work.
+  // With separate random-number streams for the shareable steps, their
+  // outcome does not depend on the instance, so instead all instances
+  // start together and split the work between them.
+  int iFirstAsync = 0;
+  if (shareInit && !settings.flag("Random:separateInitStreams")) {
+    initInstance(0);
+    iFirstAsync = 1;
   }
 
+  vector<thread> initThreads;
+  for (int iPythia = iFirstAsync; iPythia < numThreads; iPythia += 1)
+    initThreads.emplace_back(initInstance, iPythia);
+
   // Wait for all initialization threads to finish.
-  for (int i = 0; i < numThreads; ++i)
-    initThreads[i].join();
+  for (thread& initThread : initThreads)
+    initThread.join();
+
+  if (shareInit) {
+    long nStored = 0, nFound = 0;
+    for (auto& initCache : initCaches) {
+      nStored += initCache.second->nStored();
+      nFound  += initCache.second->nFound();
+    }
+    logger.INFO_MSG("shared initialization products", to_string(nStored)
+      + " stored, " + to_string(nFound) + " reused, "
+      + to_string(initCaches.size()) + " different setups");
+  }
 
   // Set initialization.
   if (!initSuccess) {
@@ -146,6 +211,17 @@ bool PythiaParallel::init(function<bool(Pythia*)> customInit) {
 
 // Run Pythia objects.
 
+// The events are grouped in chunks of Parallelism:chunkSize consecutive
+// events. Each thread owns a contiguous range of chunks, packed into a
+// single atomic word as (first << 32) | last, from which the owner takes
+// chunks at the front. Unless the load is to be balanced, a thread that
+// runs out of work steals the back half of the largest remaining range
+// of another thread. Generated events are either passed directly to the
+// callback, or handed off to a set of consumer threads that run the
+// callbacks. Since the callback is given the Pythia object itself, each
+// generating thread can only have one event waiting, and it waits until
+// that event has been processed before generating the next one.
+
 vector<long> PythiaParallel::run(long nEvents,
   function<void(Pythia* pythiaPtr)> callback) {
 
@@ -154,63 +230,193 @@ vector<long> PythiaParallel::run(long nEvents,
     return vector<long>();
   }
 
+  // Nothing to do if no events are requested.
+  if (nEvents <= 0) {
+    logger.WARNING_MSG("no events have been requested");
+    return vector<long>(numThreads, 0);
+  }
+
   if (nEvents < numThreads)
     logger.WARNING_MSG("more threads than events have been specified");
   int numThreadsNow = nEvents > numThreads ? numThreads : int(nEvents);
   long nShowCount = settings.mode("Next:numberCount");
 
+  // Split the events into chunks, to be distributed over threads.
+  // With balanced load the chunk size must be one, to keep the exact
+  // number of events generated by each instance.
+  long chunkSizeNow = balanceLoad ? 1 : chunkSize;
+  long nChunks = (nEvents + chunkSizeNow - 1) / chunkSizeNow;
+  while (nChunks >= (1L << 31)) {
+    chunkSizeNow *= 2;
+    nChunks = (nEvents + chunkSizeNow - 1) / chunkSizeNow;
+  }
+  vector< atomic<uint64_t> > chunkRanges(numThreadsNow);
+  long nChunksBase = nChunks / numThreadsNow;
+  long nChunksRest = nChunks - nChunksBase * numThreadsNow;
+  for (int iPythia = 0; iPythia < numThreadsNow; ++iPythia) {
+    uint64_t first = nChunksBase * iPythia + min<long>(iPythia, nChunksRest);
+    uint64_t last  = first + nChunksBase + (iPythia < nChunksRest ? 1 : 0);
+    chunkRanges[iPythia].store( (first << 32) | last);
+  }
+
+  // Take the first chunk of a range, or steal the back half of it.
+  // Returns the first and last chunk obtained, with first == last if none.
+  auto takeChunks = [&chunkRanges](int iRange, bool steal) {
+    uint64_t rangeOld = chunkRanges[iRange].load();
+    while (true) {
+      uint64_t first = rangeOld >> 32;
+      uint64_t last  = rangeOld & 0xffffffffULL;
+      if (first >= last) return make_pair(first, first);
+      uint64_t split = steal ? last - (last - first) / 2 : first + 1;
+      if (steal && split == last) split = first;
+      uint64_t rangeNew = steal ? (first << 32) | split
+                                : (split << 32) | last;
+      if (chunkRanges[iRange].compare_exchange_weak(rangeOld, rangeNew))
+        return steal ? make_pair(split, last) : make_pair(first, split);
+    }
+  };
+
+  // Hand-off between producer and consumer threads. A producer puts its
+  // index in the queue of ready events, and sleeps until a consumer has
+  // run the callback on its event and cleared its waiting flag.
+  bool useConsumers = numConsumers > 0;
+  mutex queueMutex;
+  std::condition_variable queueReady;
+  vector<std::condition_variable> eventDone(numThreadsNow);
+  deque<int> readyQueue;
+  vector<char> waiting(numThreadsNow, 0);
+  int nActiveProducers = numThreadsNow;
+
   mutex callbackMutex;
   vector<long> eventsPerThread(numThreadsNow);
-  atomic<long> nStartedEvents(0);
   atomic<long> nFinishedEvents(0);
   vector<thread> threads;
+  threadStats = vector<ThreadStat>(numThreadsNow);
+  for (ThreadStat& statNow : threadStats)
+    statNow.timeBins = vector<long>(NTIMEBIN, 0);
+  typedef std::chrono::steady_clock Clock;
+  auto seconds = [](Clock::time_point t0, Clock::time_point t1) {
+    return std::chrono::duration<double>(t1 - t0).count(); };
+  Clock::time_point timeStart = Clock::now();
 
   // Define the thread main that will run for each Pythia object.
   auto threadMain = [&, this, callback](Pythia* pythiaPtr, int iPythia) {
 
-    // If load is balanced, we need the number of events to run on this thread.
-    long nLocalEvents = nEvents / numThreadsNow;
-    if (iPythia < nEvents - (nLocalEvents * numThreadsNow))
-      nLocalEvents += 1;
+    ThreadStat& statNow = threadStats[iPythia];
 
-    // Run the Pythia object.
+    // Run the Pythia object, one chunk of events at a time.
     while (true) {
 
-      // Check if we're done, depending on whether load should be balanced.
-      if (balanceLoad) {
-        if (nLocalEvents == 0) break;
-        nLocalEvents -= 1;
+      // Take the next chunk in the own range, or else steal from the
+      // thread with most remaining chunks unless the load is balanced.
+      pair<uint64_t, uint64_t> chunks = takeChunks(iPythia, false);
+      while (chunks.first == chunks.second && !balanceLoad) {
+        int iVictim = -1;
+        uint64_t nMost = 0;
+        for (int i = 0; i < numThreadsNow; ++i) {
+          uint64_t range = chunkRanges[i].load();
+          uint64_t first = range >> 32;
+          uint64_t last  = range & 0xffffffffULL;
+          uint64_t nLeft = (last > first) ? last - first : 0;
+          if (nLeft > nMost) {
+            nMost   = nLeft;
+            iVictim = i;
+          }
+        }
+        if (iVictim < 0) break;
+        chunks = takeChunks(iVictim, true);
+        if (chunks.first == chunks.second) continue;
+
+        // Put the stolen range in the own, currently empty, slot.
+        ++statNow.nSteals;
+        chunkRanges[iPythia].store( (chunks.first << 32) | chunks.second);
+        chunks = takeChunks(iPythia, false);
       }
-      else if (nStartedEvents++ >= nEvents) break;
-
-      // Generate the event.
-      bool success = !doNext || pythiaPtr->next();
-
-      // Increment counter for number of generated events.
-      // Note the use of printf for thread safety.
-      eventsPerThread[iPythia] += 1;
-      long generatedEventsNow = ++nFinishedEvents;
-      if ( nShowCount > 0 && generatedEventsNow % nShowCount == 0
-        && generatedEventsNow < nEvents)
-        printf("\n PythiaParallel::run(): %ld events have been generated\n",
-          generatedEventsNow);
-
-      // Pass the generated event to the callback.
-      if (success) {
-        if (processAsync) {
-          callback(pythiaPtr);
-        } else {
-          // Lock access to the callback.
-          const std::lock_guard<mutex> lock(callbackMutex);
-          callback(pythiaPtr);
+      if (chunks.first == chunks.second) break;
+      ++statNow.nChunks;
+      long iEventEnd = min( nEvents, long(chunks.second) * chunkSizeNow);
+      long nLocalEvents = iEventEnd - long(chunks.first) * chunkSizeNow;
+
+      for (long iEvent = 0; iEvent < nLocalEvents; ++iEvent) {
+
+        // Generate the event.
+        Clock::time_point timeBegin = Clock::now();
+        bool success = !doNext || pythiaPtr->next();
+        Clock::time_point timeGenerated = Clock::now();
+        double timeEvent = seconds(timeBegin, timeGenerated);
+        statNow.timeGen += timeEvent;
+        statNow.timeMax  = max( statNow.timeMax, timeEvent);
+        ++statNow.timeBins[ (timeEvent <= TIMEMIN) ? 0 : min( NTIMEBIN - 1,
+          int( NTIMEDECADE * log10(timeEvent / TIMEMIN) ) ) ];
+
+        // Increment counter for number of generated events.
+        // Note the use of printf for thread safety.
+        eventsPerThread[iPythia] += 1;
+        long generatedEventsNow = ++nFinishedEvents;
+        if ( nShowCount > 0 && generatedEventsNow % nShowCount == 0
+          && generatedEventsNow < nEvents)
+          printf("\n PythiaParallel::run(): %ld events have been generated\n",
+            generatedEventsNow);
+
+        // Pass the generated event to the callback.
+        if (success) {
+          if (processAsync) {
+            callback(pythiaPtr);
+          } else if (useConsumers) {
+            // Queue the event and wait until a consumer is done with it.
+            std::unique_lock<mutex> lock(queueMutex);
+            waiting[iPythia] = 1;
+            readyQueue.push_back(iPythia);
+            queueReady.notify_one();
+            eventDone[iPythia].wait(lock,
+              [&]() { return waiting[iPythia] == 0; });
+          } else {
+            // Lock access to the callback.
+            const std::lock_guard<mutex> lock(callbackMutex);
+            callback(pythiaPtr);
+          }
         }
+        statNow.timeCallback += seconds(timeGenerated, Clock::now());
       }
     }
+    statNow.nEvents = eventsPerThread[iPythia];
+    statNow.timeActive = seconds(timeStart, Clock::now());
+    if (useConsumers) {
+      const std::lock_guard<mutex> lock(queueMutex);
+      if (--nActiveProducers == 0) queueReady.notify_all();
+    }
   }; // end thread main
 
+  // Define the consumer main, which runs callbacks on events handed off by
+  // producers, in the order they were queued, and sleeps while the queue
+  // is empty. It stops when the queue is empty and all producers are done.
+  auto consumerMain = [&, callback]() {
+    while (true) {
+      int iPythia;
+      {
+        std::unique_lock<mutex> lock(queueMutex);
+        queueReady.wait(lock, [&]() {
+          return !readyQueue.empty() || nActiveProducers == 0; });
+        if (readyQueue.empty()) break;
+        iPythia = readyQueue.front();
+        readyQueue.pop_front();
+      }
+      callback(pythiaObjects[iPythia].get());
+      {
+        const std::lock_guard<mutex> lock(queueMutex);
+        waiting[iPythia] = 0;
+      }
+      eventDone[iPythia].notify_one();
+    }
+  }; // end consumer main
+
   // Start all threads.
   for (int iPythia = 0; iPythia < numThreadsNow; ++iPythia)
     threads.emplace_back(threadMain, pythiaObjects[iPythia].get(), iPythia);
+  vector<thread> consumers;
+  if (useConsumers)
+    for (int iConsumer = 0; iConsumer < numConsumers; ++iConsumer)
+      consumers.emplace_back(consumerMain);
 
   // Zero the counters.
   weightSumSave = 0.;
@@ -225,6 +431,17 @@ vector<long> PythiaParallel::run(long nEvents,
     weightSumSave += weightSumNow;
     sigmaGenSave  += weightSumNow * pythiaObjects[iPythia]->info.sigmaGen();
   }
+  for (thread& consumer : consumers) consumer.join();
+  timeRun = seconds(timeStart, Clock::now());
+
+  // Combine the event generation times for tail-latency statistics.
+  eventTimeBins = vector<long>(NTIMEBIN, 0);
+  eventTimeMax  = 0.;
+  for (const ThreadStat& statNow : threadStats) {
+    for (int iBin = 0; iBin < NTIMEBIN; ++iBin)
+      eventTimeBins[iBin] += statNow.timeBins[iBin];
+    eventTimeMax = max( eventTimeMax, statNow.timeMax);
+  }
 
   // Set generated cross section and return.
   sigmaGenSave /= weightSumSave;
@@ -234,6 +451,81 @@ vector<long> PythiaParallel::run(long nEvents,
 
 //--------------------------------------------------------------------------
 
+// Write final statistics, combining errors from each Pythia instance,
+// and the scheduling statistics of the latest run.
+
+void PythiaParallel::stat() {
+  if (threadStats.size() > 0) runStatistics();
+  pythiaHelper.stat();
+}
+
+//--------------------------------------------------------------------------
+
+// Print the scheduling statistics of the latest run: per-thread
+// utilisation, i.e. the fraction of the run spent generating events and
+// in callbacks, the idle time at the tail of the run, and the
+// distribution of single-event generation times.
+
+void PythiaParallel::runStatistics() const {
+
+  // Header.
+  cout << "\n *-------  PythiaParallel Run Statistics  ---------------------"
+       << "--------------* \n"
+       << " |                                                              "
+       << "             | \n"
+       << " | thread    events  chunks  steals   gen (s)  callb (s)   util"
+       << "  tail (s) | \n"
+       << " |                                                              "
+       << "             | \n";
+
+  // Per-thread utilisation and idle time at the end of the run.
+  for (int i = 0; i < int(threadStats.size()); ++i) {
+    const ThreadStat& statNow = threadStats[i];
+    double util = (timeRun > 0.)
+      ? (statNow.timeGen + statNow.timeCallback) / timeRun : 0.;
+    cout << " | " << setw(6) << i << setw(10) << statNow.nEvents
+         << setw(8) << statNow.nChunks << setw(8) << statNow.nSteals
+         << fixed << setprecision(3) << setw(10) << statNow.timeGen
+         << setw(11) << statNow.timeCallback << setw(7) << setprecision(3)
+         << util << setw(10) << max(0., timeRun - statNow.timeActive)
+         << " | \n";
+  }
+
+  // Tail latency of single-event generation. Quantiles are taken at the
+  // logarithmic centre of the histogram bin they fall in.
+  long   nTimes   = 0;
+  double sumTimes = 0.;
+  for (const ThreadStat& statNow : threadStats) {
+    nTimes   += statNow.nEvents;
+    sumTimes += statNow.timeGen;
+  }
+  auto quantile = [&](double q) {
+    long nBelow = 0;
+    for (int iBin = 0; iBin < NTIMEBIN; ++iBin) {
+      nBelow += eventTimeBins[iBin];
+      if (nBelow > q * nTimes) return min( eventTimeMax,
+        TIMEMIN * pow( 10., (iBin + 0.5) / NTIMEDECADE) );
+    }
+    return eventTimeMax;
+  };
+  cout << " |                                                              "
+       << "             | \n"
+       << " | wall-clock time of run (s): " << setw(12) << timeRun
+       << "                                  | \n"
+       << " | event time (ms): mean " << setw(9)
+       << 1e3 * sumTimes / max(1L, nTimes) << "  median " << setw(9)
+       << 1e3 * quantile(0.5) << "  p99 " << setw(9) << 1e3 * quantile(0.99)
+       << "  max " << setw(9) << 1e3 * eventTimeMax << " | \n"
+       << " |                                                              "
+       << "             | \n"
+       << " *-------  End PythiaParallel Run Statistics  -----------------"
+       << "--------------* " << endl;
+  cout << std::defaultfloat;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Perform the specified action for each Pythia instance.
 
 void PythiaParallel::foreach(function<void(Pythia*)> action) {
@@ -182,6 +182,8 @@ bool Settings::init(string startFile, bool append) {
     // End of loop over lines in input file and loop over files.
     };
   };
+  if (!append) initFilesSave.clear();
+  initFilesSave.insert( initFilesSave.end(), files.begin(), files.end());
 
   // Set up default e+e- and pp tunes, if positive.
   int eeTune = mode("Tune:ee");
@@ -1050,6 +1052,194 @@ bool Settings::writeFileXML(ostream& os) {
 
 //--------------------------------------------------------------------------
 
+// Write the complete database in binary form. Maps are written in order,
+// so that they can be read back in with a hint at the end position.
+
+bool Settings::writeBinary(ostream& os) const {
+
+  if (!isInit) return false;
+  putBinary(os, initFilesSave);
+
+  // Flags, modes and parms.
+  putBinary(os, int(flags.size()));
+  for (auto it = flags.begin(); it != flags.end(); ++it) {
+    const Flag& f = it->second;
+    putBinary(os, it->first); putBinary(os, f.name);
+    putBinary(os, f.valNow); putBinary(os, f.valDefault);
+  }
+  putBinary(os, int(modes.size()));
+  for (auto it = modes.begin(); it != modes.end(); ++it) {
+    const Mode& m = it->second;
+    putBinary(os, it->first); putBinary(os, m.name);
+    putBinary(os, m.valNow); putBinary(os, m.valDefault);
+    putBinary(os, m.hasMin); putBinary(os, m.hasMax);
+    putBinary(os, m.valMin); putBinary(os, m.valMax);
+    putBinary(os, m.optOnly);
+  }
+  putBinary(os, int(parms.size()));
+  for (auto it = parms.begin(); it != parms.end(); ++it) {
+    const Parm& p = it->second;
+    putBinary(os, it->first); putBinary(os, p.name);
+    putBinary(os, p.valNow); putBinary(os, p.valDefault);
+    putBinary(os, p.hasMin); putBinary(os, p.hasMax);
+    putBinary(os, p.valMin); putBinary(os, p.valMax);
+  }
+
+  // Words and the vector types.
+  putBinary(os, int(words.size()));
+  for (auto it = words.begin(); it != words.end(); ++it) {
+    const Word& w = it->second;
+    putBinary(os, it->first); putBinary(os, w.name);
+    putBinary(os, w.valNow); putBinary(os, w.valDefault);
+  }
+  putBinary(os, int(fvecs.size()));
+  for (auto it = fvecs.begin(); it != fvecs.end(); ++it) {
+    const FVec& f = it->second;
+    putBinary(os, it->first); putBinary(os, f.name);
+    putBinary(os, f.valNow); putBinary(os, f.valDefault);
+  }
+  putBinary(os, int(mvecs.size()));
+  for (auto it = mvecs.begin(); it != mvecs.end(); ++it) {
+    const MVec& m = it->second;
+    putBinary(os, it->first); putBinary(os, m.name);
+    putBinary(os, m.valNow); putBinary(os, m.valDefault);
+    putBinary(os, m.hasMin); putBinary(os, m.hasMax);
+    putBinary(os, m.valMin); putBinary(os, m.valMax);
+  }
+  putBinary(os, int(pvecs.size()));
+  for (auto it = pvecs.begin(); it != pvecs.end(); ++it) {
+    const PVec& p = it->second;
+    putBinary(os, it->first); putBinary(os, p.name);
+    putBinary(os, p.valNow); putBinary(os, p.valDefault);
+    putBinary(os, p.hasMin); putBinary(os, p.hasMax);
+    putBinary(os, p.valMin); putBinary(os, p.valMax);
+  }
+  putBinary(os, int(wvecs.size()));
+  for (auto it = wvecs.begin(); it != wvecs.end(); ++it) {
+    const WVec& w = it->second;
+    putBinary(os, it->first); putBinary(os, w.name);
+    putBinary(os, w.valNow); putBinary(os, w.valDefault);
+  }
+
+  return bool(os);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in the complete database in binary form. The current database is
+// only replaced if everything could be read.
+
+bool Settings::readBinary(istream& is) {
+
+  vector<string> filesIn;
+  if (!getBinary(is, filesIn)) return false;
+  int n = 0;
+  string key;
+
+  // Flags, modes and parms.
+  map<string, Flag> flagsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    Flag f;
+    if (!getBinary(is, key) || !getBinary(is, f.name)
+      || !getBinary(is, f.valNow) || !getBinary(is, f.valDefault))
+      return false;
+    flagsIn.emplace_hint(flagsIn.end(), key, f);
+  }
+  map<string, Mode> modesIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    Mode m;
+    if (!getBinary(is, key) || !getBinary(is, m.name)
+      || !getBinary(is, m.valNow) || !getBinary(is, m.valDefault)
+      || !getBinary(is, m.hasMin) || !getBinary(is, m.hasMax)
+      || !getBinary(is, m.valMin) || !getBinary(is, m.valMax)
+      || !getBinary(is, m.optOnly)) return false;
+    modesIn.emplace_hint(modesIn.end(), key, m);
+  }
+  map<string, Parm> parmsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    Parm p;
+    if (!getBinary(is, key) || !getBinary(is, p.name)
+      || !getBinary(is, p.valNow) || !getBinary(is, p.valDefault)
+      || !getBinary(is, p.hasMin) || !getBinary(is, p.hasMax)
+      || !getBinary(is, p.valMin) || !getBinary(is, p.valMax))
+      return false;
+    parmsIn.emplace_hint(parmsIn.end(), key, p);
+  }
+
+  // Words and the vector types.
+  map<string, Word> wordsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    Word w;
+    if (!getBinary(is, key) || !getBinary(is, w.name)
+      || !getBinary(is, w.valNow) || !getBinary(is, w.valDefault))
+      return false;
+    wordsIn.emplace_hint(wordsIn.end(), key, w);
+  }
+  map<string, FVec> fvecsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    FVec f;
+    if (!getBinary(is, key) || !getBinary(is, f.name)
+      || !getBinary(is, f.valNow) || !getBinary(is, f.valDefault))
+      return false;
+    fvecsIn.emplace_hint(fvecsIn.end(), key, f);
+  }
+  map<string, MVec> mvecsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    MVec m;
+    if (!getBinary(is, key) || !getBinary(is, m.name)
+      || !getBinary(is, m.valNow) || !getBinary(is, m.valDefault)
+      || !getBinary(is, m.hasMin) || !getBinary(is, m.hasMax)
+      || !getBinary(is, m.valMin) || !getBinary(is, m.valMax))
+      return false;
+    mvecsIn.emplace_hint(mvecsIn.end(), key, m);
+  }
+  map<string, PVec> pvecsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    PVec p;
+    if (!getBinary(is, key) || !getBinary(is, p.name)
+      || !getBinary(is, p.valNow) || !getBinary(is, p.valDefault)
+      || !getBinary(is, p.hasMin) || !getBinary(is, p.hasMax)
+      || !getBinary(is, p.valMin) || !getBinary(is, p.valMax))
+      return false;
+    pvecsIn.emplace_hint(pvecsIn.end(), key, p);
+  }
+  map<string, WVec> wvecsIn;
+  if (!getBinary(is, n) || n < 0) return false;
+  for (int i = 0; i < n; ++i) {
+    WVec w;
+    if (!getBinary(is, key) || !getBinary(is, w.name)
+      || !getBinary(is, w.valNow) || !getBinary(is, w.valDefault))
+      return false;
+    wvecsIn.emplace_hint(wvecsIn.end(), key, w);
+  }
+
+  // Everything read successfully, so replace the database.
+  initFilesSave.swap(filesIn);
+  flags.swap(flagsIn);
+  modes.swap(modesIn);
+  parms.swap(parmsIn);
+  words.swap(wordsIn);
+  fvecs.swap(fvecsIn);
+  mvecs.swap(mvecsIn);
+  pvecs.swap(pvecsIn);
+  wvecs.swap(wvecsIn);
+  readStringHistory.resize(0);
+  readStringSubrun.clear();
+  isInit = true;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Print out table of database in lexigraphical order.
 
 void Settings::list(bool doListAll,  bool doListString, string match) {
@@ -1474,57 +1664,100 @@ void Settings::resetAll() {
 //--------------------------------------------------------------------------
 
 // Give back current value, with check that key exists.
+// Done with a single lookup, since these are used frequently.
 
 bool Settings::flag(string keyIn) {
-  if (isFlag(keyIn)) return flags[toLower(keyIn)].valNow;
+  auto entry = flags.find(toLower(keyIn));
+  if (entry != flags.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return false;
 }
 
 int Settings::mode(string keyIn) {
-  if (isMode(keyIn)) return modes[toLower(keyIn)].valNow;
+  auto entry = modes.find(toLower(keyIn));
+  if (entry != modes.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return 0;
 }
 
 double Settings::parm(string keyIn) {
-  if (isParm(keyIn)) return parms[toLower(keyIn)].valNow;
+  auto entry = parms.find(toLower(keyIn));
+  if (entry != parms.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return 0.;
 }
 
 string Settings::word(string keyIn) {
-  if (isWord(keyIn)) return words[toLower(keyIn)].valNow;
+  auto entry = words.find(toLower(keyIn));
+  if (entry != words.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return " ";
 }
 
 vector<bool> Settings::fvec(string keyIn) {
-  if (isFVec(keyIn)) return fvecs[toLower(keyIn)].valNow;
+  auto entry = fvecs.find(toLower(keyIn));
+  if (entry != fvecs.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<bool>(1, false);
 }
 
 vector<int> Settings::mvec(string keyIn) {
-  if (isMVec(keyIn)) return mvecs[toLower(keyIn)].valNow;
+  auto entry = mvecs.find(toLower(keyIn));
+  if (entry != mvecs.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<int>(1, 0);
 }
 
 vector<double> Settings::pvec(string keyIn) {
-  if (isPVec(keyIn)) return pvecs[toLower(keyIn)].valNow;
+  auto entry = pvecs.find(toLower(keyIn));
+  if (entry != pvecs.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<double>(1, 0.);
 }
 
 vector<string> Settings::wvec(string keyIn) {
-  if (isWVec(keyIn)) return wvecs[toLower(keyIn)].valNow;
+  auto entry = wvecs.find(toLower(keyIn));
+  if (entry != wvecs.end()) return entry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<string>(1, " ");
 }
 
 //--------------------------------------------------------------------------
 
+// Give back handle to current value, with check that key exists.
+
+SettingHandle<bool> Settings::flagHandle(string keyIn) {
+  auto entry = flags.find(toLower(keyIn));
+  if (entry != flags.end()) return SettingHandle<bool>(&entry->second.valNow);
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return SettingHandle<bool>();
+}
+
+SettingHandle<int> Settings::modeHandle(string keyIn) {
+  auto entry = modes.find(toLower(keyIn));
+  if (entry != modes.end()) return SettingHandle<int>(&entry->second.valNow);
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return SettingHandle<int>();
+}
+
+SettingHandle<double> Settings::parmHandle(string keyIn) {
+  auto entry = parms.find(toLower(keyIn));
+  if (entry != parms.end())
+    return SettingHandle<double>(&entry->second.valNow);
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return SettingHandle<double>();
+}
+
+SettingHandle<string> Settings::wordHandle(string keyIn) {
+  auto entry = words.find(toLower(keyIn));
+  if (entry != words.end())
+    return SettingHandle<string>(&entry->second.valNow);
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return SettingHandle<string>();
+}
+
+//--------------------------------------------------------------------------
+
 // Give back default value, with check that key exists.
 
 bool Settings::flagDefault(string keyIn) {
@@ -1891,6 +2124,7 @@ void Settings::printQuiet(bool quiet) {
   // Switch off as much output as possible.
   if (quiet) {
     flag("Init:showProcesses",               false );
+    flag("Init:showProcessTimes",            false );
     flag("Init:showMultipartonInteractions", false );
     flag("Init:showChangedSettings",         false );
     flag("Init:showAllSettings",             false );
@@ -1908,6 +2142,7 @@ void Settings::printQuiet(bool quiet) {
   // Restore ouput settings to default.
   } else {
     resetFlag("Init:showProcesses");
+    resetFlag("Init:showProcessTimes");
     resetFlag("Init:showMultipartonInteractions");
     resetFlag("Init:showChangedSettings");
     resetFlag("Init:showAllSettings");
@@ -309,6 +309,11 @@ void SimpleSpaceShower::init( BeamParticle* beamAPtrIn,
   doPartonVertex     = flag("PartonVertex:setVertex")
                      && (partonVertexPtr != 0);
 
+  // Reuse parton densities between evolution steps.
+  doCachePDF         = flag("SpaceShower:cachePDF");
+  beamStateNow       = -1;
+  beamStateLast.clear();
+
 }
 
 //--------------------------------------------------------------------------
@@ -595,6 +600,12 @@ double SimpleSpaceShower::pTnext( Event& event, double pTbegAll,
   enhanceFactors.clear();
   weightContainerPtr->weightsSimpleShower.setEnhancedTrial(0., 1.);
 
+  // Cached parton densities only for hadron and lepton beams. Any change
+  // of the beam states, by MPI, ISR or FSR recoil, affects all of them.
+  cachePDFNow   = doCachePDF && pdfMode == 0 && !beamAPtr->isGamma()
+               && !beamBPtr->isGamma();
+  if (cachePDFNow) updateBeamState();
+
   // Loop over all possible dipole ends.
   for (int iDipEnd = 0; iDipEnd < int(dipEnd.size()); ++iDipEnd) {
     iDipNow        = iDipEnd;
@@ -678,6 +689,45 @@ double SimpleSpaceShower::pTnext( Event& event, double pTbegAll,
 
 //--------------------------------------------------------------------------
 
+// Record the x, flavour and companion of all partons taken out of the
+// beams, and count any change since the last call. All parton densities
+// of the ISR evolution depend on these, via the rescaled PDFs. The new
+// values are compared with the last recorded ones in place, and only
+// overwrite them where they differ.
+
+void SimpleSpaceShower::updateBeamState() {
+
+  int  iState  = 0;
+  bool changed = (beamStateNow < 0);
+  auto record  = [&](double value) {
+    if (iState == int(beamStateLast.size())) {
+      beamStateLast.push_back( value);
+      changed = true;
+    } else if (beamStateLast[iState] != value) {
+      beamStateLast[iState] = value;
+      changed = true;
+    }
+    ++iState;
+  };
+  for (int iBeam = 0; iBeam < 2; ++iBeam) {
+    BeamParticle& beam = (iBeam == 0) ? *beamAPtr : *beamBPtr;
+    record( beam.size() );
+    for (int i = 0; i < beam.size(); ++i) {
+      record( beam[i].id() );
+      record( beam[i].x() );
+      record( beam[i].companion() );
+    }
+  }
+  if (iState < int(beamStateLast.size())) {
+    beamStateLast.resize( iState);
+    changed = true;
+  }
+  if (changed) ++beamStateNow;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Function to directly extract the probability of no emission between two
 // scales. This function is not used in the Pythia core code, but can be used
 // by external programs to extract no-emission probabilities from Pythia.
@@ -1089,13 +1139,25 @@ void SimpleSpaceShower::pT2nextQCD( double pT2begDip, double pT2endDip) {
         continue;
       }
 
+      // Optionally reuse parton densities from a previous call, if they
+      // were evaluated for the same beam state and flavour range, at most
+      // a step EVALPDFSTEP above, as would be the case within one call.
+      SpaceDipoleEnd& dip = *dipEndNow;
+      bool reusePDF = cachePDFNow && dip.beamStateSave == beamStateNow
+        && dip.idDauSave == idDaughter && dip.xDauSave == xDaughter
+        && dip.nFlavourSave == nFlavour && pT2 <= dip.pT2PDFSave
+        && pT2 >= EVALPDFSTEP * dip.pT2PDFSave;
+      if (reusePDF) pT2PDF = dip.pT2PDFSave;
+
       // Parton density of daughter at current scale.
-      pdfScale2 = (useFixedFacScale) ? fixedFacScale2 : factorMultFac * pT2;
-      xfModPrepData xfData = beam.xfModPrep(iSysNow, pdfScale2);
-      xPDFdaughter = (pdfMode == 0)
+      pdfScale2 = (useFixedFacScale) ? fixedFacScale2 : factorMultFac * pT2PDF;
+      xfModPrepData xfData = {0., 0., 0., 0., 0.};
+      if (!reusePDF) xfData = beam.xfModPrep(iSysNow, pdfScale2);
+      xPDFdaughter = (reusePDF) ? dip.xPDFdauSave : (pdfMode == 0)
         ? beam.xfISR(iSysNow, idDaughter, xDaughter, pdfScale2, xfData)
         : 1.;
-      if (pdfMode == 0 && xPDFdaughter < TINYPDF) {
+      if (pdfMode == 0 && (xPDFdaughter < TINYPDF
+        || (reusePDF && xPDFdaughter <= TINYPDF))) {
         xPDFdaughter  = TINYPDF;
         hasTinyPDFdau = true;
       }
@@ -1131,7 +1193,8 @@ void SimpleSpaceShower::pT2nextQCD( double pT2begDip, double pT2endDip) {
         xPDFmother[10] = 0.;
         for (int i = -nQuarkIn; i <= nQuarkIn; ++i) {
           if (i == 0) continue;
-          xPDFmother[i+10] = (pdfMode == 0)
+          xPDFmother[i+10] = (reusePDF) ? dip.xPDFmoSave[i+10]
+            : (pdfMode == 0)
             ? beam.xfISR(iSysNow, i, xDaughter, pdfScale2, xfData) : 1.;
           xPDFmotherSum += xPDFmother[i+10];
         }
@@ -1203,7 +1266,7 @@ void SimpleSpaceShower::pT2nextQCD( double pT2begDip, double pT2endDip) {
         }
 
         // Parton density of a potential gluon mother to a q.
-        xPDFgMother = (pdfMode == 0)
+        xPDFgMother = (reusePDF) ? dip.xPDFgMoSave : (pdfMode == 0)
           ? beam.xfISR(iSysNow, 21, xDaughter, pdfScale2, xfData) : 1.;
         if (nQuarkIn == 0) xPDFgMother = 0.;
 
@@ -1215,6 +1278,18 @@ void SimpleSpaceShower::pT2nextQCD( double pT2begDip, double pT2endDip) {
 
       }
 
+      // Save parton densities for later calls.
+      if (cachePDFNow && !reusePDF) {
+        dip.beamStateSave = beamStateNow;
+        dip.idDauSave     = idDaughter;
+        dip.nFlavourSave  = nFlavour;
+        dip.xDauSave      = xDaughter;
+        dip.pT2PDFSave    = pT2PDF;
+        dip.xPDFdauSave   = xPDFdaughter;
+        dip.xPDFgMoSave   = xPDFgMother;
+        for (int i = 0; i < 21; ++i) dip.xPDFmoSave[i] = xPDFmother[i];
+      }
+
       // End evaluation of splitting kernels and parton densities.
       needNewPDF = false;
     }
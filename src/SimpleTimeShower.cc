@@ -219,6 +219,13 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   // Consisteny check for gamma -> f fbar variables.
   if (nGammaToQuark <= 0 && nGammaToLepton <= 0) doQEDshowerByGamma = false;
 
+  // Settings read when setting up dipoles, which may be changed between
+  // events, e.g. when reading LHEF input. Handles avoid repeated lookups.
+  setProductionScalesLHEF
+    = settingsPtr->flagHandle("Beams:setProductionScalesFromLHEF");
+  setDipoleScalesLHEF
+    = settingsPtr->flagHandle("Beams:setDipoleShowerStartingScalesFromLHEF");
+
   // Possibility of a global recoil stategy, e.g. for MC@NLO.
   globalRecoil       = flag("TimeShower:globalRecoil");
   nMaxGlobalRecoil   = mode("TimeShower:nMaxGlobalRecoil");
@@ -226,6 +233,7 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   nMaxGlobalBranch   = mode("TimeShower:nMaxGlobalBranch");
   // Number of partons in Born-like events, to distinguish between S and H.
   nFinalBorn         = mode("TimeShower:nPartonsInBorn");
+  nFinalBornSet      = settingsPtr->modeHandle("TimeShower:nPartonsInBorn");
   // Flag to allow to start from a scale smaller than scalup.
   globalRecoilMode   = mode("TimeShower:globalRecoilMode");
   // Flag to allow to start from a scale smaller than scalup.
@@ -345,6 +353,13 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   doPartonVertex     = flag("PartonVertex:setVertex")
                      && (partonVertexPtr != 0);
 
+  // Reuse trial emissions of unchanged QCD dipoles. Not when trial
+  // emissions carry weights, or when the global state of the event enters.
+  doCacheTrials      = flag("TimeShower:cacheTrials") && !doUncertainties
+    && !canEnhanceEmission && !canEnhanceTrial && !globalRecoil
+    && !doOniumShower && !skipFirstMECinHardProc
+    && skipFirstMECinResDecIDs.empty();
+
 }
 
 //--------------------------------------------------------------------------
@@ -685,7 +700,7 @@ void SimpleTimeShower::prepareGlobal( Event& event) {
   nHard      = 0;
   nProposed.clear();
   hardPartons.resize(0);
-  nFinalBorn = mode("TimeShower:nPartonsInBorn");
+  nFinalBorn = nFinalBornSet();
 
   // Global recoils: store positions of hard outgoing partons.
   // No global recoil for H events.
@@ -1538,13 +1553,12 @@ void SimpleTimeShower::setupQCDdip( int iSys, int i, int colTag, int colSign,
 
     // If requested, force maximal pT to LHEF input value.
     if ( abs(event[iRad].status()) > 20 &&  abs(event[iRad].status()) < 24
-      && ( settingsPtr->flag("Beams:setProductionScalesFromLHEF")
-        || settingsPtr->flag("Beams:setDipoleShowerStartingScalesFromLHEF") )
+      && ( setProductionScalesLHEF() || setDipoleScalesLHEF() )
       && event[iRad].scale() > 0.) {
       double scaleNow = event[iRad].scale();
       // If the LHEF contains dipole starting scales, extract the relevant
       // scales from info.
-      if (settingsPtr->flag("Beams:setDipoleShowerStartingScalesFromLHEF") ) {
+      if (setDipoleScalesLHEF() ) {
         string name="scalup_";
         ostringstream oss; oss.str("");
         oss << iRad-2 << "_" << iRec-2;
@@ -2293,6 +2307,21 @@ double SimpleTimeShower::pTnext( Event& event, double pTbegAll,
       continue;
     }
 
+    // QCD evolution for a dipole that can reuse its cached trial emission.
+    // Is not affected by other dipole ends, so evolve down to pTendAll.
+    if (doCacheTrials && dip.colType != 0 && dip.oniumType == 0
+      && dip.isrType == 0) {
+      pT2nextQCDcached(pT2begDip, pow2(pTendAll), dip, event);
+      if (dip.pT2 > pT2sel) {
+        pT2sel  = dip.pT2;
+        dipSel  = &dip;
+        iDipSel = iDip;
+        splittingNameSel = splittingNameNow;
+      }
+      continue;
+    }
+    dip.hasTrial = false;
+
     // Do QCD, QED, weak, onia or HV evolution if it makes sense.
     if (pT2begDip > pT2sel) {
       if (dip.oniumType != 0 && !oniumEmissions.empty())
@@ -2585,6 +2614,49 @@ double SimpleTimeShower::pTnext( vector<TimeDipoleEnd> dipEnds, Event event,
 
 //--------------------------------------------------------------------------
 
+// Evolve a QCD dipole end, or reuse the trial emission from a previous
+// call if the dipole is unchanged. Trial emissions are statistically
+// independent of the starting scale, so a cached trial below the new
+// starting scale is as good as a new one, provided that the range it was
+// evolved over covers the new one.
+
+void SimpleTimeShower::pT2nextQCDcached(double pT2begDip, double pT2endAll,
+  TimeDipoleEnd& dip, Event& event) {
+
+  // Check whether cached trial is available for the current dipole.
+  if ( dip.hasTrial && dip.iRadTrial == dip.iRadiator
+    && dip.iRecTrial == dip.iRecoiler && dip.colTypeTrial == dip.colType
+    && dip.MEtypeTrial == dip.MEtype && dip.mRadTrial == dip.mRad
+    && dip.mRecTrial == dip.mRec && dip.mDipTrial == dip.mDip
+    && dip.flexTrial == dip.flexFactor && pT2begDip <= dip.pT2begTrial
+    && dip.pT2Trial <= pT2begDip
+    && (dip.pT2Trial > 0. || pT2endAll >= dip.pT2endTrial) ) {
+    dip.pT2 = dip.pT2Trial;
+    splittingNameNow = "";
+    return;
+  }
+
+  // Else evolve the dipole and store the outcome.
+  dip.pT2 = 0.;
+  splittingNameNow = "";
+  if (pT2begDip > pT2endAll) pT2nextQCD(pT2begDip, pT2endAll, dip, event);
+  dip.hasTrial     = true;
+  dip.iRadTrial    = dip.iRadiator;
+  dip.iRecTrial    = dip.iRecoiler;
+  dip.colTypeTrial = dip.colType;
+  dip.MEtypeTrial  = dip.MEtype;
+  dip.mRadTrial    = dip.mRad;
+  dip.mRecTrial    = dip.mRec;
+  dip.mDipTrial    = dip.mDip;
+  dip.flexTrial    = dip.flexFactor;
+  dip.pT2begTrial  = pT2begDip;
+  dip.pT2endTrial  = pT2endAll;
+  dip.pT2Trial     = dip.pT2;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Evolve a QCD dipole end.
 
 void SimpleTimeShower::pT2nextQCD(double pT2begDip, double pT2sel,
@@ -3680,6 +3752,10 @@ void SimpleTimeShower::pT2nextOnium(double pT2begDip, double pT2sel,
 
 bool SimpleTimeShower::branch( Event& event, bool isInterleaved) {
 
+  // The trial emission of the selected dipole end is used up, whether
+  // accepted or not. (But not if another shower component won instead.)
+  dipSel->hasTrial = false;
+
   // Check if this system is part of the hard scattering
   // (including resonance decay products).
   bool hardSystem = partonSystemsPtr->getHard(dipSel->system);
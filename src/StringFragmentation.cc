@@ -120,7 +120,7 @@ void StringEnd::newHadron(double kappaRatio, bool forbidPopcornNow,
     pyHad = pyOld + pyNew;
 
     // Pick its mass and thereby define its transverse mass.
-    mHad   = particleDataPtr->mSel(idHad);
+    mHad   = particleDataPtr->mSel(idHad, rndmPtr);
     mT2Had = pow2(mHad) + pow2(pxHad) + pow2(pyHad);
   }
 
@@ -145,7 +145,7 @@ void StringEnd::pearlHadron(StringSystem& system, int idPearlIn,
   do {
     idHad = flavSelPtr->combine( flavOld, flavNew);
   } while (idHad == 0 || abs(idHad) > 10000);
-  mHad   = particleDataPtr->mSel(idHad);
+  mHad   = particleDataPtr->mSel(idHad, rndmPtr);
   mT2Had = pow2(mHad) + pow2(pxHad + pxPearl) + pow2(pyHad + pyPearl);
 }
 
@@ -719,8 +719,10 @@ void StringFragmentation::init(StringFlav* flavSelPtrIn,
   hadrons.init( "(string fragmentation)", particleDataPtr);
 
   // Send on pointers to the two StringEnd instances.
-  posEnd.init( particleDataPtr, flavSelPtr, pTSelPtr, zSelPtr, *settingsPtr);
-  negEnd.init( particleDataPtr, flavSelPtr, pTSelPtr, zSelPtr, *settingsPtr);
+  posEnd.init( particleDataPtr, flavSelPtr, pTSelPtr, zSelPtr, *settingsPtr,
+    rndmPtr);
+  negEnd.init( particleDataPtr, flavSelPtr, pTSelPtr, zSelPtr, *settingsPtr,
+    rndmPtr);
 
   // Optionally allow for closepacking and reduced diquark formation.
   closePacking             = flag("ClosePacking:doClosePacking");
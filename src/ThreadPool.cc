@@ -0,0 +1,115 @@
+// ThreadPool.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Function definitions (not found in the header) for the ThreadPool class.
+
+#include "Pythia8/ThreadPool.h"
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The ThreadPool class.
+
+//--------------------------------------------------------------------------
+
+// Constructor starts the helper threads.
+
+ThreadPool::ThreadPool(int nThreadsIn) : batchNow(0), nBusy(0),
+  stopNow(false), taskPtr(nullptr), nTaskNow(0), iTaskNext(0) {
+  for (int i = 1; i < nThreadsIn; ++i)
+    helpers.emplace_back(&ThreadPool::helperMain, this);
+}
+
+//--------------------------------------------------------------------------
+
+// Destructor stops and joins the helper threads.
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> lock(poolMutex);
+    stopNow = true;
+  }
+  wakeUp.notify_all();
+  for (thread& helper : helpers) helper.join();
+}
+
+//--------------------------------------------------------------------------
+
+// Execute task(i) for i = 0, ..., nTask - 1 and wait for completion.
+
+void ThreadPool::run(int nTask, const function<void(int)>& task) {
+
+  // Nothing to share: do the work directly.
+  if (helpers.empty() || nTask < 2) {
+    for (int i = 0; i < nTask; ++i) task(i);
+    return;
+  }
+
+  // Hand out the new batch and wake up the helpers.
+  {
+    lock_guard<mutex> lock(poolMutex);
+    taskPtr   = &task;
+    nTaskNow  = nTask;
+    iTaskNext = 0;
+    nBusy     = int(helpers.size());
+    taskException = nullptr;
+    ++batchNow;
+  }
+  wakeUp.notify_all();
+
+  // The calling thread participates, then waits for all helpers to have
+  // checked in, so that the batch can safely be replaced.
+  work();
+  std::unique_lock<mutex> lock(poolMutex);
+  allDone.wait(lock, [this] { return nBusy == 0; });
+  taskPtr = nullptr;
+
+  // Pass on an exception from any of the tasks, as if run serially.
+  if (taskException) {
+    std::exception_ptr exceptionNow = taskException;
+    taskException = nullptr;
+    std::rethrow_exception(exceptionNow);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Main loop of each helper thread.
+
+void ThreadPool::helperMain() {
+  long batchDone = 0;
+  while (true) {
+    {
+      std::unique_lock<mutex> lock(poolMutex);
+      wakeUp.wait(lock, [&] { return stopNow || batchNow != batchDone; });
+      if (stopNow) return;
+      batchDone = batchNow;
+    }
+    work();
+    lock_guard<mutex> lock(poolMutex);
+    if (--nBusy == 0) allDone.notify_one();
+  }
+}
+
+//--------------------------------------------------------------------------
+
+// Execute tasks of the current batch until none are left. An exception
+// is caught and kept for the calling thread, and stops the batch.
+
+void ThreadPool::work() {
+  try {
+    for (int i = iTaskNext++; i < nTaskNow; i = iTaskNext++) (*taskPtr)(i);
+  } catch (...) {
+    lock_guard<mutex> lock(poolMutex);
+    if (!taskException) taskException = std::current_exception();
+    iTaskNext = nTaskNow;
+  }
+}
+
+//==========================================================================
+
+} // end namespace Pythia8
@@ -1744,14 +1744,14 @@ bool VinciaCommon::clus3to2(const VinciaClustering& clus,
   pAnew.id(clus.idMot1);
   pAnew.cols(colA, acolA);
   pAnew.pol(polA);
-  pAnew.setPDEPtr(particleDataPtr->findParticle(clus.idMot1));
+  pAnew.setPDEPtr(particleDataPtr->findEntry(clus.idMot1));
   pAnew.m(clus.mMot.at(0));
   Particle pBnew = state.at(ib);
   pBnew.id(clus.idMot2);
   pBnew.cols(colB, acolB);
   pBnew.pol(polB);
   pBnew.m(clus.mMot.at(1));
-  pBnew.setPDEPtr(particleDataPtr->findParticle(clus.idMot2));
+  pBnew.setPDEPtr(particleDataPtr->findEntry(clus.idMot2));
 
   // Set list of clustered particles with new momenta.
   int iOffset = 0;
@@ -1831,13 +1831,13 @@ bool VinciaCommon::clus3to2(const VinciaClustering& clus, const Event& event,
   pAnew.cols(colA, acolA);
   pAnew.pol(polA);
   pAnew.m(clus.mMot.at(0));
-  pAnew.setPDEPtr(particleDataPtr->findParticle(clus.idMot1));
+  pAnew.setPDEPtr(particleDataPtr->findEntry(clus.idMot1));
   Particle pBnew = event[ibEvt];
   pBnew.id(clus.idMot2);
   pBnew.cols(colB, acolB);
   pBnew.pol(polB);
   pBnew.m(clus.mMot.at(1));
-  pBnew.setPDEPtr(particleDataPtr->findParticle(clus.idMot2));
+  pBnew.setPDEPtr(particleDataPtr->findEntry(clus.idMot2));
 
   // Set list of clustered particles with new momenta.
   int iOffset = 0;